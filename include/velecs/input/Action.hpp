@@ -11,11 +11,18 @@
 #pragma once
 
 #include "velecs/input/InputBindings/InputBinding.hpp"
+#include "velecs/input/BindingProgram.hpp"
+#include "velecs/input/ActionStateTable.hpp"
+#include "velecs/input/ActionEventQueue.hpp"
+#include "velecs/input/ActionMask.hpp"
+#include "velecs/input/KeyBitset.hpp"
+#include "velecs/input/ActionHandle.hpp"
 
 #include <velecs/common/Event.hpp>
 #include <velecs/common/NameUuidRegistry.hpp>
 
 #include <string>
+#include <vector>
 
 namespace velecs::input {
 
@@ -38,22 +45,37 @@ using Uuid = velecs::common::Uuid;
 /// jumpAction.performed.Subscribe([](){ /* Handle jump performed */ });
 /// jumpAction.Disable(); // Temporarily disable this action
 /// @endcode
+///
+/// The result of each frame is also recorded in a shared ActionStateTable, so actions
+/// can be polled after Input::Update() instead of subscribed to:
+///
+/// @code
+/// if (jumpAction.WasStartedThisFrame()) { /* Jump pressed this frame */ }
+/// Vec2 move = moveAction.ReadValue<Vec2>();
+/// @endcode
 class Action {
 public:
     using Status = InputStatus;
 
     // Enums
 
+    /// @enum TriggerMode
+    /// @brief When an active action invokes performed
+    enum class TriggerMode : uint8_t {
+        Continuous,   ///< Every frame while a binding is active (default)
+        ValueChanged, ///< Only when the value changes, or the status has an edge
+    };
+
     // Public Fields
 
     /// @brief Event triggered when the action starts (e.g., button press begins)
-    velecs::common::Event<InputBindingContext> started;
+    velecs::common::Event<const InputBindingContext&> started;
     
     /// @brief Event triggered when the action is performed (e.g., button press completes)
-    velecs::common::Event<InputBindingContext> performed;
+    velecs::common::Event<const InputBindingContext&> performed;
     
     /// @brief Event triggered when the action is cancelled (e.g., button release before completion)
-    velecs::common::Event<InputBindingContext> cancelled;
+    velecs::common::Event<const InputBindingContext&> cancelled;
 
     // Constructors and Destructors
 
@@ -68,13 +90,29 @@ public:
     /// @param name Unique name for this action within its map
     /// @param key Constructor access key (restricts creation to ActionMap class)
     inline Action(const ActionMap& map, const std::string& name, ConstructorKey)
-        : _map(map), _name(name) {}
+        : _map(map), _name(name), _stateIndex(_states.Allocate())
+    {
+        _enabledActions.Set(_stateIndex);
+        if (_stateIndex >= _actionsByIndex.size()) _actionsByIndex.resize(_stateIndex + 1, nullptr);
+        _actionsByIndex[_stateIndex] = this;
+    }
+
+    /// @brief Default constructor is deleted, every action must own a state table slot
+    Action() = delete;
 
-    /// @brief Default constructor
-    Action() = default;
+    /// @brief Copy constructor is deleted, each action owns a single state table slot
+    Action(const Action&) = delete;
 
-    /// @brief Default destructor
-    ~Action() = default;
+    /// @brief Copy assignment is deleted, each action owns a single state table slot
+    Action& operator=(const Action&) = delete;
+
+    /// @brief Destructor - releases the action's state table slot
+    inline ~Action()
+    {
+        _actionsByIndex[_stateIndex] = nullptr;
+        _enabledActions.Reset(_stateIndex);
+        _states.Release(_stateIndex);
+    }
 
     // Public Methods
 
@@ -82,17 +120,43 @@ public:
     /// @return true if the action is enabled, false otherwise
     /// @note Both the action and its parent ActionMap must be enabled for processing
     /// @see Enable(), Disable()
-    inline bool IsEnabled() const { return _enabled; }
+    inline bool IsEnabled() const { return _enabledActions.Test(_stateIndex); }
 
     /// @brief Enables this Action for input processing
     /// @note The parent ActionMap must also be enabled for this action to be processed
     /// @see Disable(), IsEnabled()
-    inline void Enable() { _enabled = true; }
+    inline void Enable()
+    {
+        _enabledActions.Set(_stateIndex);
+        BindingProgram::MarkEnableChanged();
+    }
     
     /// @brief Disables this Action, preventing it from being processed during input handling
     /// @note The action will remain disabled even if the parent ActionMap is disabled and re-enabled
     /// @see Enable(), IsEnabled()
-    inline void Disable() { _enabled = false; }
+    inline void Disable()
+    {
+        _enabledActions.Reset(_stateIndex);
+        BindingProgram::MarkEnableChanged();
+    }
+
+    /// @brief Enables every action in a mask with one word-wise operation
+    /// @param actions Mask of state indices, such as ActionMap::GetActionMask() or a
+    ///        mask built for an application-defined tag
+    static inline void EnableAll(const ActionMask& actions)
+    {
+        _enabledActions.SetAll(actions);
+        BindingProgram::MarkEnableChanged();
+    }
+
+    /// @brief Disables every action in a mask with one word-wise operation
+    /// @param actions Mask of state indices, such as ActionMap::GetActionMask() or a
+    ///        mask built for an application-defined tag
+    static inline void DisableAll(const ActionMask& actions)
+    {
+        _enabledActions.ResetAll(actions);
+        BindingProgram::MarkEnableChanged();
+    }
 
     /// @brief Gets the parent ActionMap that owns this Action
     /// @return Const reference to the parent ActionMap
@@ -103,14 +167,83 @@ public:
     /// @return Const reference to the action name
     inline const std::string& GetName() const { return _name; }
 
+    /// @brief Gets when this action invokes performed
+    /// @return The action's trigger mode
+    inline TriggerMode GetTriggerMode() const { return _triggerMode; }
+
+    /// @brief Sets when this action invokes performed
+    /// @param mode Continuous to fire every active frame, ValueChanged to fire only when
+    ///             the value changes
+    /// @note started and cancelled always fire in either mode, and the polled state is
+    ///       still updated every frame
+    inline void SetTriggerMode(const TriggerMode mode) { _triggerMode = mode; }
+
+    /// @brief Gets the status this action dispatched during the last Input::Update()
+    /// @return The status, or Idle if the action did not dispatch
+    inline Status GetStatus() const { return _states.GetStatus(_stateIndex); }
+
+    /// @brief Checks if the action started during the last Input::Update()
+    inline bool WasStartedThisFrame() const { return HasAnyFlag(GetStatus(), Status::Started); }
+
+    /// @brief Checks if the action performed during the last Input::Update()
+    /// @note true on every frame the action is held, not only the first
+    inline bool IsPerformed() const { return HasAnyFlag(GetStatus(), Status::Performed); }
+
+    /// @brief Checks if the action was cancelled during the last Input::Update()
+    inline bool WasCancelledThisFrame() const { return HasAnyFlag(GetStatus(), Status::Cancelled); }
+
+    /// @brief Reads the value this action dispatched during the last Input::Update()
+    /// @tparam T bool, float or velecs::math::Vec2, see ActionStateTable::ReadValue()
+    /// @return The value, or a zero value if the action did not dispatch
+    template<typename T>
+    inline T ReadValue() const { return _states.template ReadValue<T>(_stateIndex); }
+
+    /// @brief Gets this action's slot in the state table
+    /// @return Index for use with GetStateTable()
+    inline uint32_t GetStateIndex() const { return _stateIndex; }
+
+    /// @brief Gets a handle to this action
+    /// @return Handle that resolves to this action until it is destroyed
+    inline ActionHandle GetHandle() const { return ActionHandle{_stateIndex, _states.GetGeneration(_stateIndex)}; }
+
+    /// @brief Resolves a handle to its action without any name lookup
+    /// @param handle Handle from GetHandle()
+    /// @param outAction Reference to store pointer to the action if it still exists
+    /// @return true if the handle's action still exists, false otherwise
+    static inline bool TryResolve(const ActionHandle& handle, Action*& outAction)
+    {
+        if (handle.index >= _actionsByIndex.size()) return false;
+        Action* const action = _actionsByIndex[handle.index];
+        if (action == nullptr || _states.GetGeneration(handle.index) != handle.generation) return false;
+        outAction = action;
+        return true;
+    }
+
+    /// @brief Gets the table holding every action's state
+    /// @return The shared table, for polling many actions in one loop
+    static inline const ActionStateTable& GetStateTable() { return _states; }
+
+    /// @brief Gets every key read by this action's bindings
+    /// @return Keys claimed from lower maps when this action's map consumes input
+    /// @see ActionMap::SetInputConsumption()
+    inline const KeyBitset& GetBoundKeys() const { return _boundKeys; }
+
     template<typename T, typename... Args>
     Action& AddBinding(const std::string& name, Args&&... args)
     {
         auto [binding, uuid] = _bindings.EmplaceAs<T>(name, std::forward<Args>(args)...);
+        binding.CollectKeys(_boundKeys);
+        BindingProgram::MarkStale();
         return *this;
     }
 
-    void Process(const InputPollingState& state);
+    /// @brief Evaluates this action's bindings and dispatches the first non-idle one
+    /// @param state Input state for the frame being evaluated
+    /// @param claimedKeys Keys claimed by higher priority maps, bindings reading any of
+    ///        them are skipped
+    /// @note An action left with no active binding only because its held binding was
+    ///       claimed is cancelled
+    void Process(const InputPollingState& state, const KeyBitset& claimedKeys);
 
 protected:
     // Protected Fields
@@ -118,10 +251,15 @@ protected:
     // Protected Methods
 
 private:
+    friend class ActionMap;
+    friend class BindingProgram;
+    friend class ProfileCompiler;
+    friend class Input;
+
     // Private Fields
 
-    /// @brief Whether this action is currently enabled for input processing
-    bool _enabled{true};
+    /// @brief When performed is invoked
+    TriggerMode _triggerMode{TriggerMode::Continuous};
     
     /// @brief Reference to the parent ActionMap that owns this action
     const ActionMap& _map;
@@ -131,7 +269,47 @@ private:
 
     InputBindingRegistry _bindings;
 
+    /// @brief Union of the keys read by _bindings
+    KeyBitset _boundKeys;
+
+    /// @brief This action's slot in _states
+    const uint32_t _stateIndex;
+
+    /// @brief Status and value of every action, written by Dispatch()
+    /// @note Never destroyed, so actions in static profiles can still release their slots at exit
+    inline static ActionStateTable& _states = *new ActionStateTable();
+
+    /// @brief Enable bit of every action, indexed by state index
+    /// @note Never destroyed, for the same reason as _states
+    inline static ActionMask& _enabledActions = *new ActionMask();
+
+    /// @brief Owner of each state index, null for released slots
+    /// @note Never destroyed, for the same reason as _states
+    inline static std::vector<Action*>& _actionsByIndex = *new std::vector<Action*>();
+
+    /// @brief Queue events are recorded into instead of invoked, null for immediate dispatch
+    /// @note Set by Input while deferred dispatch is enabled
+    inline static ActionEventQueue* _deferredQueue{nullptr};
+
     // Private Methods
+
+    /// @brief Invokes the events for a binding's status
+    /// @param bindingStatus Status reported by the first non-idle binding
+    /// @param context Context filled in by that binding
+    /// @note Adds Started when the action turns active without a start edge, so handlers
+    ///       always see started before performed
+    void Dispatch(const Status bindingStatus, const InputBindingContext& context);
+
+    /// @brief Cancels this action if it ended the previous frame active
+    /// @param state Input state for the frame being evaluated
+    /// @note Used when a higher map claims the action's input, so an action held when the
+    ///       claim begins still sees cancelled
+    void Interrupt(const InputPollingState& state);
+
+    /// @brief Invokes one of this action's events, or queues it when dispatch is deferred
+    /// @param kind Which event to fire
+    /// @param context Context to pass to the event's handlers
+    void Fire(const ActionEventQueue::Kind kind, const InputBindingContext& context);
 };
 
 } // namespace velecs::input
\ No newline at end of file
@@ -0,0 +1,144 @@
+/// @file    ActionEventQueue.hpp
+/// @author  Matthew Green
+/// @date    2026-10-15 17:06:51
+///
+/// @section LICENSE
+///
+/// Copyright (c) 2026 Matthew Green - All rights reserved
+/// Unauthorized copying of this file, via any medium is strictly prohibited
+/// Proprietary and confidential
+
+#pragma once
+
+#include "velecs/input/InputBindings/InputBindingContext.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace velecs::input {
+
+class Action;
+
+/// @class ActionEventQueue
+/// @brief Records action events during evaluation and invokes them later in one batch
+///
+/// With deferred dispatch enabled (see Input::SetDeferredDispatch()), Action records its
+/// started, performed and cancelled events here instead of invoking them during binding
+/// evaluation. Input::Update() then flushes the queue once evaluation has finished. User
+/// handlers therefore never run while profiles are being walked, so they may freely add
+/// profiles, maps, actions or bindings.
+///
+/// The queue keeps its capacity between frames, so steady-state frames do not allocate.
+///
+/// @code
+/// ActionEventQueue queue;
+/// queue.Push(action, ActionEventQueue::Kind::Started, context);
+/// queue.Flush(ActionEventQueue::DispatchOrder::GroupedByAction);
+/// @endcode
+class ActionEventQueue {
+public:
+    // Enums
+
+    /// @enum Kind
+    /// @brief Which of an action's events was fired
+    enum class Kind : uint8_t {
+        Started,
+        Performed,
+        Cancelled,
+    };
+
+    /// @enum DispatchOrder
+    /// @brief Order in which Flush() invokes queued events
+    /// @note Events are grouped by action rather than by handler. velecs::common::Event does
+    ///       not expose its handlers, and splitting an action's events by kind would reorder
+    ///       a cancel and restart within one frame. An action's handlers still run together.
+    enum class DispatchOrder : uint8_t {
+        Recorded,        ///< The order the events fired in, same as immediate dispatch
+        GroupedByAction, ///< Events of the same action back to back, each action's own order kept
+    };
+
+    // Public Fields
+
+    /// @brief Events the queue has room for before its first allocation
+    static constexpr std::size_t DEFAULT_CAPACITY = 256;
+
+    // Constructors and Destructors
+
+    /// @brief Default constructor - creates an empty queue with DEFAULT_CAPACITY reserved
+    ActionEventQueue();
+
+    /// @brief Copy constructor is deleted, queued events point at live actions
+    ActionEventQueue(const ActionEventQueue&) = delete;
+
+    /// @brief Copy assignment is deleted, queued events point at live actions
+    ActionEventQueue& operator=(const ActionEventQueue&) = delete;
+
+    /// @brief Default destructor
+    ~ActionEventQueue() = default;
+
+    // Public Methods
+
+    /// @brief Records an event to invoke on the next Flush()
+    /// @param action The action that fired the event
+    /// @param kind Which of the action's events fired
+    /// @param context Context to pass to the event's handlers
+    /// @note The context's details are copied, the pointer is repaired on Flush()
+    inline void Push(Action& action, const Kind kind, const InputBindingContext& context)
+    {
+        _events.push_back(QueuedEvent{&action, kind, context, context.GetDetails()});
+    }
+
+    /// @brief Invokes every queued event and empties the queue
+    /// @param order Order to invoke the events in
+    /// @return Number of events invoked
+    /// @note Events a handler fires during the flush, such as the cancels from a
+    ///       Input::LoadProfiles() call, are invoked after the current batch
+    std::size_t Flush(const DispatchOrder order);
+
+    /// @brief Discards every queued event without invoking it
+    inline void Clear() { _events.clear(); }
+
+    /// @brief Gets the number of queued events
+    inline std::size_t GetSize() const { return _events.size(); }
+
+    /// @brief Checks if no events are queued
+    inline bool IsEmpty() const { return _events.empty(); }
+
+protected:
+    // Protected Fields
+
+    // Protected Methods
+
+private:
+    // Private Fields
+
+    /// @struct QueuedEvent
+    /// @brief One recorded event
+    struct QueuedEvent {
+        Action* action;
+        Kind kind;
+        InputBindingContext context;
+        InputBindingDetails details;
+    };
+
+    /// @brief Events recorded since the last Flush(), in firing order
+    std::vector<QueuedEvent> _events;
+
+    /// @brief Batch being invoked by Flush(), swapped out of _events so handlers can push
+    std::vector<QueuedEvent> _dispatching;
+
+    /// @brief Scratch for GroupByAction(), swapped with _dispatching once filled
+    std::vector<QueuedEvent> _grouped;
+
+    /// @brief Start of each state index's run in _grouped, reused between flushes
+    std::vector<uint32_t> _groupOffsets;
+
+    // Private Methods
+
+    /// @brief Reorders _dispatching so each action's events are contiguous, keeping the
+    ///        order within an action
+    void GroupByAction();
+};
+
+} // namespace velecs::input
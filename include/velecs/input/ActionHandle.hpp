@@ -0,0 +1,47 @@
+/// @file    ActionHandle.hpp
+/// @author  Matthew Green
+/// @date    2026-10-15 18:34:52
+///
+/// @section LICENSE
+///
+/// Copyright (c) 2026 Matthew Green - All rights reserved
+/// Unauthorized copying of this file, via any medium is strictly prohibited
+/// Proprietary and confidential
+
+#pragma once
+
+#include <cstdint>
+
+namespace velecs::input {
+
+/// @struct ActionHandle
+/// @brief Lightweight reference to an action, resolved without any name lookup
+///
+/// A handle is the action's slot in the ActionStateTable plus the slot's generation.
+/// Slots are reused once an action is destroyed, and reuse bumps the generation, so a
+/// handle to a destroyed action fails to resolve instead of reaching its successor.
+///
+/// @code
+/// ActionHandle jump = jumpAction.GetHandle(); // Once, at setup
+/// Action* action = nullptr;
+/// if (Action::TryResolve(jump, action) && action->WasStartedThisFrame()) { /* ... */ }
+/// @endcode
+struct ActionHandle {
+    /// @brief Slot index of a handle that refers to no action
+    static constexpr uint32_t INVALID_INDEX = UINT32_MAX;
+
+    /// @brief The action's slot in the ActionStateTable
+    uint32_t index{INVALID_INDEX};
+
+    /// @brief Generation of the slot when the handle was taken
+    uint32_t generation{0};
+
+    /// @brief Checks if the handle was taken from an action
+    /// @note A valid handle can still fail to resolve once its action is destroyed
+    constexpr bool IsValid() const { return index != INVALID_INDEX; }
+
+    constexpr bool operator==(const ActionHandle& other) const { return index == other.index && generation == other.generation; }
+    constexpr bool operator!=(const ActionHandle& other) const { return !(*this == other); }
+};
+
+} // namespace velecs::input
@@ -11,9 +11,11 @@
 #pragma once
 
 #include "velecs/input/Action.hpp"
+#include "velecs/input/NameKeyIndex.hpp"
 
 #include <velecs/common/NameUuidRegistry.hpp>
 
+#include <cstdint>
 #include <string>
 #include <memory>
 #include <unordered_set>
@@ -43,10 +45,28 @@ using Uuid = velecs::common::Uuid;
 /// playerMap.Disable(); // Disables map processing, actions unchanged
 /// playerMap.DisableAllActions(); // Disables each action individually
 /// @endcode
+///
+/// Within a profile, maps form a priority stack. Higher priority maps are evaluated
+/// first, and a map that consumes input hides it from the maps below while enabled:
+///
+/// @code
+/// uiMap.SetPriority(10);
+/// uiMap.SetInputConsumption(ActionMap::InputConsumption::BoundKeys);
+/// // Gameplay bindings reading any key bound in uiMap are skipped while uiMap is enabled
+/// @endcode
 class ActionMap {
 public:
     // Enums
 
+    /// @enum InputConsumption
+    /// @brief Which input an enabled map hides from lower priority maps in its profile
+    enum class InputConsumption : uint8_t {
+        None,      ///< Lower maps see all input (default)
+        BoundKeys, ///< Keys read by this map's enabled actions are claimed, lower bindings
+                   ///< reading any claimed key are skipped
+        All,       ///< Lower maps are skipped entirely
+    };
+
     // Public Fields
 
     // Constructors and Destructors
@@ -79,20 +99,65 @@ public:
     /// @note Does not modify the Actions themselves, only affects processing
     /// @note Not to be confused with `EnableAllActions()` which modifies individual Action states
     /// @see IsEnabled(), DisableAllActions(), EnableAllActions()
-    inline void Enable() { _enabled = true; }
+    inline void Enable()
+    {
+        _enabled = true;
+        BindingProgram::MarkEnableChanged();
+    }
 
     /// @brief Disables this map, causing all its Actions to be ignored during input processing
     /// @note Does not modify the Actions themselves, only affects processing
     /// @note When re-enabled, Actions retain their previous enabled/disabled states
     /// @note Not to be confused with `DisableAllActions()` which modifies individual Action states  
     /// @see IsEnabled(), EnableAllActions(), DisableAllActions()
-    inline void Disable() { _enabled = false; }
+    inline void Disable()
+    {
+        _enabled = false;
+        BindingProgram::MarkEnableChanged();
+    }
+
+    /// @brief Gets this map's position in its profile's map stack
+    /// @return The priority, higher maps are evaluated first
+    inline int GetPriority() const { return _priority; }
+
+    /// @brief Sets this map's position in its profile's map stack
+    /// @param priority Higher maps are evaluated first, maps of equal priority keep the
+    ///        order they were added in
+    inline void SetPriority(const int priority)
+    {
+        _priority = priority;
+        BindingProgram::MarkStale();
+    }
+
+    /// @brief Gets which input this map hides from lower priority maps
+    /// @return The map's consumption mode
+    inline InputConsumption GetInputConsumption() const { return _inputConsumption; }
+
+    /// @brief Sets which input this map hides from lower priority maps while enabled
+    /// @param consumption None to share all input, BoundKeys to claim the keys read by
+    ///        this map's enabled actions, All to hide every input
+    /// @note A claimed key only blocks the lower bindings that read it, an action with
+    ///       other bindings keeps running on them, and a held action that loses its only
+    ///       active binding is cancelled
+    inline void SetInputConsumption(const InputConsumption consumption)
+    {
+        _inputConsumption = consumption;
+        BindingProgram::MarkEnableChanged();
+    }
+
+    /// @brief Adds the keys read by this map's enabled actions to a bitset
+    /// @param outKeys Bitset to add the keys to
+    void CollectBoundKeys(KeyBitset& outKeys);
 
     /// @brief Gets the parent ActionProfile that owns this ActionMap
     /// @return Const reference to the parent ActionProfile
     /// @note The returned reference remains valid for the lifetime of this ActionMap
     inline const ActionProfile& GetProfile() const { return _profile; }
 
+    /// @brief Gets a mask with the bit of every action in this map set
+    /// @return Mask for use with Action::EnableAll() and Action::DisableAll()
+    inline const ActionMask& GetActionMask() const { return _actionMask; }
+
     /// @brief Gets the name of this action map
     /// @return Const reference to the map name
     inline const std::string& GetName() const { return _name; }
@@ -100,7 +165,8 @@ public:
     /// @brief Adds a new action to this map and configures it
     /// @param name Unique name for the action within this map
     /// @param configurator Function to configure the newly created action
-    /// @throws std::runtime_error if action with same name already exists in this map
+    /// @throws std::runtime_error if action with same name already exists in this map, or
+    ///         another action's name has the same NameKey
     ActionMap& AddAction(const std::string& name, std::function<void(Action&)> configurator);
 
     /// @brief Attempts to retrieve an action by UUID
@@ -115,21 +181,36 @@ public:
     /// @return true if action was found, false otherwise
     bool TryGetAction(const std::string& name, Action*& outAction) const { return _actions.TryGetRef(name, outAction); }
 
+    /// @brief Attempts to retrieve an action by the key of its name, without building a string
+    /// @param key Key of the action's name, typically a constexpr NameKey
+    /// @param outAction Reference to store pointer to the action if found
+    /// @return true if action was found, false otherwise
+    inline bool TryGetAction(const NameKey key, Action*& outAction) const { return _actionKeys.TryGet(key, outAction); }
+
     /// @brief Enables all Actions within this map individually
-    /// @note This modifies each Action's enabled state directly
+    /// @note This modifies each Action's enabled state directly, as one mask operation
     /// @note Map must also be enabled for Actions to be processed
     /// @note Not to be confused with `Enable()` which only affects map-level processing
     /// @see Enable(), DisableAllActions()
     void EnableAllActions();
 
     /// @brief Disables all Actions within this map individually  
-    /// @note This modifies each Action's enabled state directly
+    /// @note This modifies each Action's enabled state directly, as one mask operation
     /// @note Actions remain disabled even if map is disabled then re-enabled
     /// @note Not to be confused with `Disable()` which only affects map-level processing
     /// @see Disable(), EnableAllActions()
     void DisableAllActions();
 
-    void Process(const InputPollingState& state);
+    /// @brief Processes this map's enabled actions, skipping bindings that read a claimed key
+    /// @param state Input state for the frame being evaluated
+    /// @param claimedKeys Keys claimed by higher priority maps
+    void Process(const InputPollingState& state, const KeyBitset& claimedKeys);
+
+    /// @brief Cancels this map's held actions when a higher map starts consuming all input
+    /// @param state Input state for the frame being evaluated
+    /// @note Only walks the actions on the first call after the map was last processed, so
+    ///       a map that stays hidden costs nothing
+    void Hide(const InputPollingState& state);
 
 protected:
     // Protected Fields
@@ -137,11 +218,27 @@ protected:
     // Protected Methods
 
 private:
+    friend class BindingProgram;
+    friend class ProfileCompiler;
+    friend class Input;
+
     // Private Fields
 
     /// @brief Whether this map is currently enabled for input processing
     bool _enabled{true};
 
+    /// @brief Which input this map hides from lower priority maps
+    InputConsumption _inputConsumption{InputConsumption::None};
+
+    /// @brief Set by Hide(), cleared by Process()
+    bool _isHidden{false};
+
+    /// @brief Position in the profile's map stack, higher is evaluated first
+    int _priority{0};
+
+    /// @brief State indices of this map's actions
+    ActionMask _actionMask;
+
     /// @brief Reference to the parent ActionProfile that owns this map
     const ActionProfile& _profile;
     
@@ -151,6 +248,9 @@ private:
     /// @brief Registry of actions belonging to this map
     ActionRegistry _actions;
 
+    /// @brief _actions indexed by NameKey
+    NameKeyIndex<Action> _actionKeys;
+
     // Private Methods
 };
 
@@ -0,0 +1,121 @@
+/// @file    ActionMask.hpp
+/// @author  Matthew Green
+/// @date    2026-10-15 17:52:36
+///
+/// @section LICENSE
+///
+/// Copyright (c) 2026 Matthew Green - All rights reserved
+/// Unauthorized copying of this file, via any medium is strictly prohibited
+/// Proprietary and confidential
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace velecs::input {
+
+/// @class ActionMask
+/// @brief Growable bitset with one bit per action, indexed by Action::GetStateIndex()
+///
+/// Enable state is kept as masks so that enabling or disabling a whole group of actions
+/// (a map, or any user-defined tag) is a word-wise operation rather than a walk over
+/// the actions. Each ActionMap keeps a mask of its own actions, and applications can
+/// build masks for their own tags.
+///
+/// @code
+/// ActionMask uiActions;
+/// uiActions.Set(confirmAction.GetStateIndex());
+/// uiActions.Set(backAction.GetStateIndex());
+/// Action::DisableAll(uiActions);
+/// @endcode
+class ActionMask {
+public:
+    // Enums
+
+    // Public Fields
+
+    /// @brief Number of bits in a single storage word
+    static constexpr std::size_t WORD_BITS = 64;
+
+    // Constructors and Destructors
+
+    /// @brief Default constructor - creates a mask with no bits set
+    ActionMask() = default;
+
+    // Public Methods
+
+    /// @brief Checks if the bit for an action is set
+    /// @param index The action's state index
+    /// @return true if set, false otherwise or if the index is beyond the mask
+    inline bool Test(const uint32_t index) const
+    {
+        const std::size_t word = index / WORD_BITS;
+        if (word >= _words.size()) return false;
+        return (_words[word] >> (index % WORD_BITS)) & 1u;
+    }
+
+    /// @brief Sets the bit for an action, growing the mask if needed
+    /// @param index The action's state index
+    inline void Set(const uint32_t index)
+    {
+        const std::size_t word = index / WORD_BITS;
+        if (word >= _words.size()) _words.resize(word + 1, 0);
+        _words[word] |= uint64_t{1} << (index % WORD_BITS);
+    }
+
+    /// @brief Clears the bit for an action
+    /// @param index The action's state index
+    inline void Reset(const uint32_t index)
+    {
+        const std::size_t word = index / WORD_BITS;
+        if (word >= _words.size()) return;
+        _words[word] &= ~(uint64_t{1} << (index % WORD_BITS));
+    }
+
+    /// @brief Sets every bit that is set in another mask
+    /// @param other Mask of bits to set
+    inline void SetAll(const ActionMask& other)
+    {
+        if (other._words.size() > _words.size()) _words.resize(other._words.size(), 0);
+        for (std::size_t i = 0; i < other._words.size(); ++i) _words[i] |= other._words[i];
+    }
+
+    /// @brief Clears every bit that is set in another mask
+    /// @param other Mask of bits to clear
+    inline void ResetAll(const ActionMask& other)
+    {
+        const std::size_t count = other._words.size() < _words.size() ? other._words.size() : _words.size();
+        for (std::size_t i = 0; i < count; ++i) _words[i] &= ~other._words[i];
+    }
+
+    /// @brief Clears every bit
+    inline void Clear()
+    {
+        for (uint64_t& word : _words) word = 0;
+    }
+
+    /// @brief Checks if any bit is set
+    inline bool Any() const
+    {
+        uint64_t combined = 0;
+        for (const uint64_t word : _words) combined |= word;
+        return combined != 0;
+    }
+
+protected:
+    // Protected Fields
+
+    // Protected Methods
+
+private:
+    // Private Fields
+
+    /// @brief Storage words, bit (index % 64) of word (index / 64) represents an action
+    std::vector<uint64_t> _words;
+
+    // Private Methods
+};
+
+} // namespace velecs::input
@@ -10,12 +10,16 @@
 
 #pragma once
 
+#include "velecs/input/NameKeyIndex.hpp"
+
 #include <velecs/common/NameUuidRegistry.hpp>
 
+#include <cstdint>
 #include <string>
 #include <unordered_map>
 #include <memory>
 #include <functional>
+#include <vector>
 
 namespace velecs::input {
 
@@ -87,12 +91,12 @@ public:
     /// @brief Enables this profile, making all its enabled ActionMaps active for input processing
     /// @note Does not modify the ActionMaps or Actions themselves, only affects processing
     /// @see IsEnabled(), Disable()
-    inline void Enable() { _enabled = true; }
+    void Enable();
     
     /// @brief Disables this profile, causing all its ActionMaps to be ignored during input processing
     /// @note Does not modify the ActionMaps or Actions themselves, only affects processing
     /// @see IsEnabled(), Enable()
-    inline void Disable() { _enabled = false; }
+    void Disable();
 
     /// @brief Gets the name of this action profile
     /// @return Const reference to the profile name
@@ -102,7 +106,8 @@ public:
     /// @param name Unique name for the action map within this profile
     /// @param configurator Function to configure the newly created map
     /// @return Reference to this ActionProfile for method chaining
-    /// @throws std::runtime_error if map with same name already exists in this profile
+    /// @throws std::runtime_error if map with same name already exists in this profile, or
+    ///         another map's name has the same NameKey
     ActionProfile& AddMap(const std::string& name, std::function<void(ActionMap&)> configurator);
 
     /// @brief Attempts to retrieve an action map by UUID
@@ -117,6 +122,20 @@ public:
     /// @return true if action map was found, false otherwise
     inline bool TryGetMap(const std::string& name, ActionMap*& outMap) const { return _maps.TryGetRef(name, outMap); }
 
+    /// @brief Attempts to retrieve an action map by the key of its name, without building a string
+    /// @param key Key of the map's name, typically a constexpr NameKey
+    /// @param outMap Reference to store pointer to the action map if found
+    /// @return true if action map was found, false otherwise
+    inline bool TryGetMap(const NameKey key, ActionMap*& outMap) const { return _mapKeys.TryGet(key, outMap); }
+
+    /// @brief Gets this profile's maps in evaluation order
+    /// @return Maps sorted by descending priority, equal priorities in the order they were added
+    /// @see ActionMap::SetPriority()
+    const std::vector<ActionMap*>& GetMapStack();
+
+    /// @brief Processes enabled maps from the top of the stack down, hiding the input
+    ///        each consuming map claims from the maps below it
+    /// @param state Input state for the frame being evaluated
     void Process(const InputPollingState& state);
 
 protected:
@@ -125,6 +144,9 @@ protected:
     // Protected Methods
 
 private:
+    friend class BindingProgram;
+    friend class ProfileCompiler;
+
     // Private Fields
 
     /// @brief Whether this profile is currently enabled for input processing
@@ -136,6 +158,15 @@ private:
     /// @brief Registry of action maps belonging to this profile
     ActionMapRegistry _maps;
 
+    /// @brief _maps indexed by NameKey
+    NameKeyIndex<ActionMap> _mapKeys;
+
+    /// @brief _maps sorted by priority, rebuilt when the source revision changes
+    std::vector<ActionMap*> _mapStack;
+
+    /// @brief BindingProgram source revision _mapStack was sorted at
+    uint64_t _mapStackRevision{~uint64_t{0}};
+
     // Private Methods
 };
 
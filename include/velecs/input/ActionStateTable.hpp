@@ -0,0 +1,191 @@
+/// @file    ActionStateTable.hpp
+/// @author  Matthew Green
+/// @date    2026-10-15 16:41:27
+///
+/// @section LICENSE
+///
+/// Copyright (c) 2026 Matthew Green - All rights reserved
+/// Unauthorized copying of this file, via any medium is strictly prohibited
+/// Proprietary and confidential
+
+#pragma once
+
+#include "velecs/input/InputStatus.hpp"
+#include "velecs/input/InputBindings/InputBindingContext.hpp"
+
+#include <velecs/math/Vec2.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace velecs::input {
+
+/// @class ActionStateTable
+/// @brief Struct-of-arrays record of every action's status and value for the current frame
+///
+/// Each Action owns one slot. Whenever an action dispatches its events the status and
+/// value are also written here, so systems can poll actions instead of subscribing to
+/// them. Slots live in parallel arrays (status, value type, x, y, frame written), which
+/// keeps a loop over many actions on contiguous memory.
+///
+/// Slots are not cleared between frames. Each write records the frame number, and a
+/// slot not written during the current frame reads as Idle with a zero value. Advancing
+/// the frame is therefore O(1) no matter how many actions exist.
+///
+/// @code
+/// const ActionStateTable& states = Action::GetStateTable();
+/// for (const Action* action : movers)
+/// {
+///     Vec2 move = states.ReadValue<Vec2>(action->GetStateIndex());
+/// }
+/// @endcode
+class ActionStateTable {
+public:
+    // Enums
+
+    // Public Fields
+
+    using ValueType = InputBindingContext::ValueType;
+
+    // Constructors and Destructors
+
+    /// @brief Default constructor - creates an empty table
+    ActionStateTable() = default;
+
+    /// @brief Copy constructor is deleted, actions hold indices into a single table
+    ActionStateTable(const ActionStateTable&) = delete;
+
+    /// @brief Copy assignment is deleted, actions hold indices into a single table
+    ActionStateTable& operator=(const ActionStateTable&) = delete;
+
+    /// @brief Default destructor
+    ~ActionStateTable() = default;
+
+    // Public Methods
+
+    /// @brief Reserves a slot for a new action
+    /// @return Index of the slot, reusing a released one when available
+    uint32_t Allocate();
+
+    /// @brief Returns a slot to the table and bumps its generation
+    /// @param index Index returned by Allocate()
+    void Release(const uint32_t index);
+
+    /// @brief Gets how many times a slot has been released
+    /// @param index The slot
+    /// @return The slot's generation, see ActionHandle
+    inline uint32_t GetGeneration(const uint32_t index) const { return _generations[index]; }
+
+    /// @brief Starts a new frame, every slot reads as Idle until written again
+    inline void AdvanceFrame() { ++_frame; }
+
+    /// @brief Records an action's status and value for the current frame
+    /// @param index The action's slot
+    /// @param status Status dispatched by the action
+    /// @param context Context of the binding that produced the status
+    void Write(const uint32_t index, const InputStatus status, const InputBindingContext& context);
+
+    /// @brief Checks if a context carries the value last written to a slot
+    /// @param index The action's slot
+    /// @param context Context about to be written
+    /// @return true if the value type and value match the slot's last write, from any frame
+    bool IsSameValue(const uint32_t index, const InputBindingContext& context) const;
+
+    /// @brief Checks if an action ended the previous frame active
+    /// @param index The action's slot
+    /// @return true if the slot was written during the previous frame with Performed set
+    inline bool WasPerformedLastFrame(const uint32_t index) const
+    {
+        return _writtenFrames[index] + 1 == _frame && HasAnyFlag(_statuses[index], InputStatus::Performed);
+    }
+
+    /// @brief Gets the number of slots, including released ones
+    inline std::size_t GetSize() const { return _statuses.size(); }
+
+    /// @brief Gets an action's status for the current frame
+    /// @param index The action's slot
+    /// @return The dispatched status, or Idle if the action did not dispatch this frame
+    inline InputStatus GetStatus(const uint32_t index) const
+    {
+        return IsWrittenThisFrame(index) ? _statuses[index] : InputStatus::Idle;
+    }
+
+    /// @brief Gets the type of an action's value for the current frame
+    /// @param index The action's slot
+    /// @return The binding's value type, or None if the action did not dispatch this frame
+    inline ValueType GetValueType(const uint32_t index) const
+    {
+        return IsWrittenThisFrame(index) ? _valueTypes[index] : ValueType::None;
+    }
+
+    /// @brief Reads an action's value for the current frame
+    ///
+    /// Supported types are bool, float and velecs::math::Vec2. Values convert between
+    /// types: a Bool value reads as 0.0 or 1.0, a Vec2 reads as true when either
+    /// component is non-zero and reads its x component as a float.
+    ///
+    /// @tparam T bool, float or velecs::math::Vec2
+    /// @param index The action's slot
+    /// @return The value, or a zero value if the action did not dispatch this frame
+    template<typename T>
+    T ReadValue(const uint32_t index) const;
+
+protected:
+    // Protected Fields
+
+    // Protected Methods
+
+private:
+    // Private Fields
+
+    std::vector<InputStatus> _statuses;
+    std::vector<ValueType> _valueTypes;
+    std::vector<float> _valueX;
+    std::vector<float> _valueY;
+
+    /// @brief Frame number of each slot's last write
+    std::vector<uint32_t> _writtenFrames;
+
+    /// @brief Number of times each slot has been released
+    std::vector<uint32_t> _generations;
+
+    /// @brief Released slots, reused before the arrays grow
+    std::vector<uint32_t> _freeSlots;
+
+    /// @brief Current frame number, starts at 1 so fresh slots read as unwritten
+    uint32_t _frame{1};
+
+    // Private Methods
+
+    /// @brief Checks if a slot was written during the current frame
+    inline bool IsWrittenThisFrame(const uint32_t index) const { return _writtenFrames[index] == _frame; }
+
+    /// @brief Converts a context's value into the table's x/y form
+    /// @param context The context to convert
+    /// @param outX Receives the x component, or the bool/float value
+    /// @param outY Receives the y component, 0.0 for non-Vec2 values
+    static void ToComponents(const InputBindingContext& context, float& outX, float& outY);
+};
+
+template<>
+inline bool ActionStateTable::ReadValue<bool>(const uint32_t index) const
+{
+    if (!IsWrittenThisFrame(index)) return false;
+    return _valueX[index] != 0.0f || _valueY[index] != 0.0f;
+}
+
+template<>
+inline float ActionStateTable::ReadValue<float>(const uint32_t index) const
+{
+    return IsWrittenThisFrame(index) ? _valueX[index] : 0.0f;
+}
+
+template<>
+inline velecs::math::Vec2 ActionStateTable::ReadValue<velecs::math::Vec2>(const uint32_t index) const
+{
+    if (!IsWrittenThisFrame(index)) return velecs::math::Vec2::ZERO;
+    return velecs::math::Vec2{_valueX[index], _valueY[index]};
+}
+
+} // namespace velecs::input
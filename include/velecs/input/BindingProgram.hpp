@@ -0,0 +1,269 @@
+/// @file    BindingProgram.hpp
+/// @author  Matthew Green
+/// @date    2026-10-15 15:20:37
+///
+/// @section LICENSE
+///
+/// Copyright (c) 2026 Matthew Green - All rights reserved
+/// Unauthorized copying of this file, via any medium is strictly prohibited
+/// Proprietary and confidential
+
+#pragma once
+
+#include "velecs/input/InputBindings/ButtonBinding.hpp"
+#include "velecs/input/InputBindings/Vec2Binding.hpp"
+#include "velecs/input/InputBindings/MouseButtonBinding.hpp"
+#include "velecs/input/InputBindings/MouseDeltaBinding.hpp"
+#include "velecs/input/Vec2CompositeBatch.hpp"
+
+#include <velecs/common/NameUuidRegistry.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace velecs::input {
+
+struct InputPollingState;
+class ActionProfile;
+class ActionMap;
+class Action;
+
+using ActionProfileRegistry = velecs::common::NameUuidRegistry<ActionProfile>;
+
+/// @class BindingProgram
+/// @brief Flattened, contiguous form of every profile's bindings, executed in one loop
+///
+/// Walking profiles, maps, actions and bindings through four levels of NameUuidRegistry
+/// costs a pointer chase per level per frame. A BindingProgram walks the tree once and
+/// stores the result as two plain arrays:
+/// - one ActionRange per action, in the same order the tree walk visits them
+/// - one BindingRecord per binding, grouped so each action's bindings are contiguous
+///
+/// Execute() then produces exactly the same callbacks as the tree walk while touching
+/// only those arrays and the bindings themselves.
+///
+/// Evaluation is incremental. Build() asks every binding which keys it reads (see
+/// InputBinding::CollectKeys()) and stores a reverse index from scancode to dependent
+/// actions. Each frame only three groups of actions are evaluated:
+/// - actions reading a key that changed this frame, found through the reverse index
+/// - actions that were not Idle last frame, so held inputs keep emitting performed
+/// - actions with any binding that is not purely key driven
+/// Every other action would report Idle, so a frame with no key changes costs
+/// O(held actions) rather than O(bindings).
+///
+/// Built-in binding types are not called through InputBinding's vtable. Build() copies
+/// each one's plain Data into a homogeneous array for its type, and the record stores a
+/// type tag and an index into that array. Execute() switches on the tag and calls the
+/// type's static Evaluate() directly. Bindings of any other type keep a pointer and are
+/// evaluated through the virtual ProcessStatus().
+///
+/// Vec2Binding composites are stored in a Vec2CompositeBatch instead. The batch runs
+/// once per frame, so its carried deadzone state never misses a change, and recomputes
+/// only the composites reading a key that changed that frame.
+///
+/// The program does not observe its source. Any structural change (a new profile, map,
+/// action or binding) calls MarkStale(), and the owner rebuilds before the next
+/// Execute(). Toggling a profile, map or action calls MarkEnableChanged() instead, and
+/// the next Execute() refreshes one effective enable flag per action without a rebuild.
+/// Disabled actions are then never queued, so a disabled map costs nothing per frame,
+/// and actions enabled by the refresh are evaluated once so held input resumes.
+///
+/// Maps are compiled in stack order (see ActionProfile::GetMapStack()). Input claimed by
+/// a consuming map depends only on which actions are enabled, so the refresh also folds
+/// the claims into the enable flags. Actions blocked by a higher map are never queued,
+/// and an open menu that consumes all input costs nothing for the maps beneath it.
+///
+/// @code
+/// if (program.IsStale()) program.Build(profiles);
+/// program.Execute(state);
+/// @endcode
+class BindingProgram {
+public:
+    // Enums
+
+    // Public Fields
+
+    // Constructors and Destructors
+
+    /// @brief Default constructor - creates an empty, stale program
+    BindingProgram() = default;
+
+    /// @brief Copy constructor is deleted, records point into the program's source profiles
+    BindingProgram(const BindingProgram&) = delete;
+
+    /// @brief Copy assignment is deleted, records point into the program's source profiles
+    BindingProgram& operator=(const BindingProgram&) = delete;
+
+    /// @brief Default destructor
+    ~BindingProgram() = default;
+
+    // Public Methods
+
+    /// @brief Flags every BindingProgram as needing a rebuild
+    /// @note Called whenever a profile, map, action or binding is added
+    static inline void MarkStale() { ++_sourceRevision; }
+
+    /// @brief Flags every BindingProgram's enable flags as needing a refresh
+    /// @note Called whenever a profile, map or action is enabled or disabled
+    static inline void MarkEnableChanged() { ++_enableRevision; }
+
+    /// @brief Gets the revision of the source profiles
+    /// @return A value that changes whenever MarkStale() is called
+    static inline uint64_t GetSourceRevision() { return _sourceRevision; }
+
+    /// @brief Checks if the source profiles changed since the last Build()
+    /// @return true if Build() must be called before Execute()
+    inline bool IsStale() const { return _builtRevision != _sourceRevision; }
+
+    /// @brief Flattens every profile into the program's arrays
+    /// @param profiles The profiles to compile, in processing order
+    /// @note Reuses the arrays' capacity, so rebuilding a same-sized program does not allocate
+    void Build(ActionProfileRegistry& profiles);
+
+    /// @brief Runs the bindings of every enabled action affected by this frame's input
+    /// @param state Input state for the frame being evaluated
+    void Execute(const InputPollingState& state);
+
+    /// @brief Gets the number of compiled actions
+    /// @return Number of action ranges in the program
+    inline std::size_t GetActionCount() const { return _actions.size(); }
+
+    /// @brief Gets the number of compiled bindings
+    /// @return Number of binding records in the program
+    inline std::size_t GetBindingCount() const { return _bindings.size(); }
+
+protected:
+    // Protected Fields
+
+    // Protected Methods
+
+private:
+    // Private Fields
+
+    /// @struct MapRange
+    /// @brief One compiled map and the slice of action ranges it owns
+    struct MapRange {
+        const ActionProfile* profile;
+        ActionMap* map;
+        uint32_t firstAction;
+        uint32_t actionCount;
+    };
+
+    /// @struct ActionRange
+    /// @brief One compiled action and the slice of binding records it owns
+    struct ActionRange {
+        const ActionProfile* profile;
+        const ActionMap* map;
+        Action* action;
+        uint32_t firstBinding;
+        uint32_t bindingCount;
+    };
+
+    /// @enum BindingKind
+    /// @brief Which array a BindingRecord's index refers to
+    enum class BindingKind : uint8_t {
+        Virtual,     ///< _virtualBindings, evaluated through the vtable
+        Button,      ///< _buttonBindings
+        Vec2,        ///< _vec2Batch
+        MouseButton, ///< _mouseButtonBindings
+        MouseDelta,  ///< _mouseDeltaBindings
+    };
+
+    /// @struct BindingRecord
+    /// @brief One compiled binding
+    struct BindingRecord {
+        BindingKind kind;
+        uint32_t index;
+    };
+
+    /// @brief Compiled maps in processing order, including maps without actions
+    std::vector<MapRange> _maps;
+
+    /// @brief Compiled actions in processing order
+    std::vector<ActionRange> _actions;
+
+    /// @brief Compiled bindings, each action's bindings contiguous and in registry order
+    std::vector<BindingRecord> _bindings;
+
+    /// @brief Bindings of types without a static path
+    std::vector<const InputBinding*> _virtualBindings;
+
+    std::vector<ButtonBinding::Data> _buttonBindings;
+    std::vector<MouseButtonBinding::Data> _mouseButtonBindings;
+    std::vector<MouseDeltaBinding::Data> _mouseDeltaBindings;
+
+    /// @brief Every Vec2Binding, evaluated together
+    Vec2CompositeBatch _vec2Batch;
+
+    /// @brief Reverse index offsets, actions reading scancode N are
+    ///        _keyActions[_keyActionOffsets[N] .. _keyActionOffsets[N + 1])
+    std::vector<uint32_t> _keyActionOffsets;
+
+    /// @brief Action indices grouped by the scancode they read
+    std::vector<uint32_t> _keyActions;
+
+    /// @brief Actions with at least one binding that must be evaluated every frame
+    std::vector<uint32_t> _alwaysActions;
+
+    /// @brief Actions to evaluate again next frame regardless of key changes
+    std::vector<uint32_t> _activeActions;
+
+    /// @brief Actions gathered for the frame being evaluated, reused between frames
+    std::vector<uint32_t> _worklist;
+
+    /// @brief Frame stamp per action, equal to _frameStamp once the action is in the worklist
+    std::vector<uint32_t> _queuedStamps;
+
+    /// @brief 1 if the action, its map and its profile are all enabled and no higher map
+    ///        in the profile claims every one of the action's bindings
+    std::vector<uint8_t> _enabledFlags;
+
+    /// @brief 1 if a higher map in the profile claims a key the binding reads, indexed like _bindings
+    std::vector<uint8_t> _claimedFlags;
+
+    /// @brief Enable revision _enabledFlags was computed from
+    uint64_t _refreshedEnableRevision{~uint64_t{0}};
+
+    /// @brief Incremented whenever any profile, map or action is enabled or disabled
+    inline static uint64_t _enableRevision{0};
+
+    /// @brief Incremented every Execute(), lets _queuedStamps dedupe without clearing
+    uint32_t _frameStamp{0};
+
+    /// @brief Source revision this program was built from
+    uint64_t _builtRevision{~uint64_t{0}};
+
+    /// @brief Incremented on every structural change to any profile
+    inline static uint64_t _sourceRevision{0};
+
+    // Private Methods
+
+    /// @brief Appends a binding to the array for its type
+    /// @param binding The binding to compile
+    /// @return The record referring to the stored copy or pointer
+    BindingRecord Compile(const InputBinding& binding);
+
+    /// @brief Evaluates a compiled binding
+    /// @param record The binding's record
+    /// @param state Input state for the frame being evaluated
+    /// @param outContext Receives the binding's value and metadata
+    /// @return The binding's status this frame
+    InputStatus Evaluate(const BindingRecord& record, const InputPollingState& state, InputBindingContext& outContext) const;
+
+    /// @brief Recomputes _enabledFlags and _claimedFlags, queues every action that became
+    ///        enabled or had a binding unclaimed, and every enabled action with a claimed
+    ///        binding, so Execute() can cancel it if the claimed binding was held
+    void RefreshEnabled();
+
+    /// @brief Adds an action to this frame's worklist unless it is already queued or disabled
+    /// @param actionIndex Index into _actions
+    inline void Enqueue(const uint32_t actionIndex)
+    {
+        if (!_enabledFlags[actionIndex] || _queuedStamps[actionIndex] == _frameStamp) return;
+        _queuedStamps[actionIndex] = _frameStamp;
+        _worklist.push_back(actionIndex);
+    }
+};
+
+} // namespace velecs::input
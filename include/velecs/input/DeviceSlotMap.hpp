@@ -0,0 +1,196 @@
+/// @file    DeviceSlotMap.hpp
+/// @author  Matthew Green
+/// @date    2026-10-15 11:02:17
+///
+/// @section LICENSE
+///
+/// Copyright (c) 2026 Matthew Green - All rights reserved
+/// Unauthorized copying of this file, via any medium is strictly prohibited
+/// Proprietary and confidential
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace velecs::input {
+
+/// @class DeviceSlotMap
+/// @brief Fixed-capacity mapping from SDL device instance ids to dense slot indices
+///
+/// SDL hands out device ids (SDL_KeyboardID, SDL_JoystickID, SDL_MouseID) that grow
+/// without bound across hotplugs, so per-device state cannot be indexed by id directly.
+/// This map assigns each connected device the lowest free slot in [0, Capacity) and
+/// resolves ids with a small open-addressed hash table, so lookups are O(1) and never
+/// allocate. Per-device state can then live in plain arrays indexed by slot.
+///
+/// @tparam Capacity Maximum number of simultaneously connected devices (at most 32)
+///
+/// @note Id 0 is reserved by SDL for "unknown or virtual device" and is never mapped.
+///
+/// @code
+/// DeviceSlotMap<8> keyboards;
+/// int slot = keyboards.Add(keyboardId);
+/// if (slot != DeviceSlotMap<8>::INVALID_SLOT) { perKeyboardState[slot] = {}; }
+/// @endcode
+template<std::size_t Capacity>
+class DeviceSlotMap {
+    static_assert(Capacity > 0 && Capacity <= 32, "DeviceSlotMap tracks slots in a 32-bit mask");
+
+public:
+    // Enums
+
+    // Public Fields
+
+    /// @brief Slot index returned when an id is not mapped or the map is full
+    static constexpr int INVALID_SLOT = -1;
+
+    /// @brief Maximum number of simultaneously mapped devices
+    static constexpr std::size_t CAPACITY = Capacity;
+
+    // Constructors and Destructors
+
+    /// @brief Default constructor - creates an empty map
+    DeviceSlotMap() = default;
+
+    // Public Methods
+
+    /// @brief Looks up the slot assigned to a device id
+    /// @param id SDL device instance id
+    /// @return The slot index, or INVALID_SLOT if the id is not mapped
+    inline int Find(const uint32_t id) const
+    {
+        if (id == 0) return INVALID_SLOT;
+
+        for (std::size_t i = Hash(id); ; i = (i + 1) & (TABLE_SIZE - 1))
+        {
+            if (_tableIds[i] == id) return _tableSlots[i];
+            if (_tableIds[i] == 0) return INVALID_SLOT;
+        }
+    }
+
+    /// @brief Assigns a slot to a device id
+    /// @param id SDL device instance id
+    /// @return The newly assigned slot, the existing slot if already mapped, or
+    ///         INVALID_SLOT if the id is 0 or every slot is in use
+    inline int Add(const uint32_t id)
+    {
+        if (id == 0) return INVALID_SLOT;
+
+        const int existing = Find(id);
+        if (existing != INVALID_SLOT) return existing;
+
+        int slot = INVALID_SLOT;
+        for (std::size_t i = 0; i < Capacity; ++i)
+        {
+            if ((_activeMask & (uint32_t{1} << i)) == 0)
+            {
+                slot = static_cast<int>(i);
+                break;
+            }
+        }
+        if (slot == INVALID_SLOT) return INVALID_SLOT;
+
+        std::size_t i = Hash(id);
+        while (_tableIds[i] != 0) i = (i + 1) & (TABLE_SIZE - 1);
+        _tableIds[i] = id;
+        _tableSlots[i] = static_cast<int8_t>(slot);
+
+        _slotIds[slot] = id;
+        _activeMask |= uint32_t{1} << slot;
+        return slot;
+    }
+
+    /// @brief Releases the slot assigned to a device id
+    /// @param id SDL device instance id
+    /// @return The slot that was released, or INVALID_SLOT if the id was not mapped
+    inline int Remove(const uint32_t id)
+    {
+        if (id == 0) return INVALID_SLOT;
+
+        std::size_t i = Hash(id);
+        while (_tableIds[i] != id)
+        {
+            if (_tableIds[i] == 0) return INVALID_SLOT;
+            i = (i + 1) & (TABLE_SIZE - 1);
+        }
+
+        const int slot = _tableSlots[i];
+
+        // Backward-shift deletion keeps probe chains intact without tombstones
+        std::size_t hole = i;
+        for (std::size_t j = (i + 1) & (TABLE_SIZE - 1); _tableIds[j] != 0; j = (j + 1) & (TABLE_SIZE - 1))
+        {
+            const std::size_t home = Hash(_tableIds[j]);
+            const bool homeBetween = (hole <= j) ? (hole < home && home <= j) : (hole < home || home <= j);
+            if (homeBetween) continue;
+
+            _tableIds[hole] = _tableIds[j];
+            _tableSlots[hole] = _tableSlots[j];
+            hole = j;
+        }
+        _tableIds[hole] = 0;
+
+        _slotIds[slot] = 0;
+        _activeMask &= ~(uint32_t{1} << slot);
+        return slot;
+    }
+
+    /// @brief Gets the device id occupying a slot
+    /// @param slot Slot index in [0, Capacity)
+    /// @return The device id, or 0 if the slot is free or out of range
+    inline uint32_t GetId(const int slot) const
+    {
+        if (slot < 0 || static_cast<std::size_t>(slot) >= Capacity) return 0;
+        return _slotIds[slot];
+    }
+
+    /// @brief Gets a bitmask with one bit set per occupied slot
+    /// @return Mask where bit N is set if slot N is in use
+    inline uint32_t GetActiveMask() const { return _activeMask; }
+
+    /// @brief Checks if a slot is currently occupied
+    /// @param slot Slot index to check
+    /// @return true if a device is mapped to the slot, false otherwise
+    inline bool IsActive(const int slot) const
+    {
+        if (slot < 0 || static_cast<std::size_t>(slot) >= Capacity) return false;
+        return (_activeMask & (uint32_t{1} << slot)) != 0;
+    }
+
+protected:
+    // Protected Fields
+
+    // Protected Methods
+
+private:
+    // Private Fields
+
+    /// @brief Hash table size, kept at least four times the capacity so probe chains stay short
+    static constexpr std::size_t TABLE_SIZE =
+        Capacity <= 2 ? 8 : Capacity <= 4 ? 16 : Capacity <= 8 ? 32 : Capacity <= 16 ? 64 : 128;
+
+    /// @brief Device ids stored in the hash table, 0 marks an empty bucket
+    uint32_t _tableIds[TABLE_SIZE]{};
+
+    /// @brief Slot index for each occupied hash table bucket
+    int8_t _tableSlots[TABLE_SIZE]{};
+
+    /// @brief Device id occupying each slot, 0 if free
+    uint32_t _slotIds[Capacity]{};
+
+    /// @brief Bit N set if slot N is occupied
+    uint32_t _activeMask{0};
+
+    // Private Methods
+
+    /// @brief Computes the home bucket of a device id
+    /// @param id Non-zero SDL device instance id
+    /// @return Bucket index in [0, TABLE_SIZE)
+    static inline std::size_t Hash(const uint32_t id)
+    {
+        return static_cast<std::size_t>((id * 2654435761u) >> 16) & (TABLE_SIZE - 1);
+    }
+};
+
+} // namespace velecs::input
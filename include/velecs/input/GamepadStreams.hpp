@@ -0,0 +1,113 @@
+/// @file    GamepadStreams.hpp
+/// @author  Matthew Green
+/// @date    2026-10-15 13:58:09
+///
+/// @section LICENSE
+///
+/// Copyright (c) 2026 Matthew Green - All rights reserved
+/// Unauthorized copying of this file, via any medium is strictly prohibited
+/// Proprietary and confidential
+
+#pragma once
+
+#include "velecs/input/SampleRing.hpp"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace velecs::input {
+
+/// @enum GamepadSensor
+/// @brief Motion sensors streamed per gamepad
+enum class GamepadSensor : uint8_t {
+    Accel = 0, ///< Accelerometer, m/s^2 (SDL_SENSOR_ACCEL)
+    Gyro,      ///< Gyroscope, rad/s (SDL_SENSOR_GYRO)
+    Count,     ///< Number of streamed sensors
+};
+
+/// @struct SensorSample
+/// @brief A single motion sensor reading
+struct SensorSample {
+    /// @brief SDL event timestamp in nanoseconds
+    uint64_t timestampNs{0};
+
+    /// @brief Timestamp reported by the sensor itself in nanoseconds, 0 if unavailable
+    uint64_t sensorTimestampNs{0};
+
+    /// @brief Sensor axes as reported by SDL (x, y, z)
+    float data[3]{};
+};
+
+/// @enum TouchpadPhase
+/// @brief Which touchpad event produced a TouchpadSample
+enum class TouchpadPhase : uint8_t {
+    Down,   ///< Finger touched the touchpad
+    Motion, ///< Finger moved on the touchpad
+    Up,     ///< Finger was lifted
+};
+
+/// @struct TouchpadSample
+/// @brief A single touchpad finger event
+struct TouchpadSample {
+    /// @brief SDL event timestamp in nanoseconds
+    uint64_t timestampNs{0};
+
+    /// @brief Touchpad index on the gamepad
+    int32_t touchpad{0};
+
+    /// @brief Finger index on the touchpad
+    int32_t finger{0};
+
+    /// @brief Normalized position, 0.0 at the left edge to 1.0 at the right edge
+    float x{0.0f};
+
+    /// @brief Normalized position, 0.0 at the top edge to 1.0 at the bottom edge
+    float y{0.0f};
+
+    /// @brief Normalized pressure from 0.0 to 1.0
+    float pressure{0.0f};
+
+    /// @brief Event that produced this sample
+    TouchpadPhase phase{TouchpadPhase::Down};
+};
+
+/// @struct GamepadStreams
+/// @brief Per-gamepad ring buffers for high-rate sensor and touchpad data
+///
+/// Gyro and accelerometer data arrive at several hundred Hz, well above the frame rate.
+/// Each stream keeps every sample of the frame with its timestamp, so aim code can
+/// integrate each reading instead of sampling whatever arrived last.
+struct GamepadStreams {
+public:
+    // Public Fields
+
+    /// @brief Samples retained per sensor stream between frames
+    static constexpr std::size_t SENSOR_CAPACITY = 256;
+
+    /// @brief Samples retained for the touchpad stream between frames
+    static constexpr std::size_t TOUCHPAD_CAPACITY = 128;
+
+    /// @brief One ring per GamepadSensor
+    SampleRing<SensorSample, SENSOR_CAPACITY> sensors[static_cast<std::size_t>(GamepadSensor::Count)];
+
+    /// @brief Touchpad finger events from every touchpad on the gamepad
+    SampleRing<TouchpadSample, TOUCHPAD_CAPACITY> touchpad;
+
+    // Public Methods
+
+    /// @brief Captures the samples that arrived since the previous frame on every stream
+    inline void Latch()
+    {
+        for (auto& sensor : sensors) sensor.Latch();
+        touchpad.Latch();
+    }
+
+    /// @brief Discards every sample on every stream
+    inline void Reset()
+    {
+        for (auto& sensor : sensors) sensor.Reset();
+        touchpad.Reset();
+    }
+};
+
+} // namespace velecs::input
@@ -10,24 +10,78 @@
 
 #pragma once
 
+#include "velecs/input/KeyBitset.hpp"
+#include "velecs/input/GamepadStreams.hpp"
+#include "velecs/input/ActionEventQueue.hpp"
+#include "velecs/input/NameKeyIndex.hpp"
+
 #include <velecs/common/NameUuidRegistry.hpp>
+#include <velecs/math/Vec2.hpp>
 
 #include <SDL3/SDL.h>
 
+#include <cstddef>
+#include <cstdint>
 #include <memory>
 #include <unordered_map>
 #include <set>
 #include <string>
+#include <vector>
 
 namespace velecs::input {
 
 struct InputPollingState;
+class BindingProgram;
 
 class ActionProfile;
+class ProfileImage;
+class ProfileWatcher;
+class ActionMap;
+class Action;
 using ActionProfileRegistry = velecs::common::NameUuidRegistry<ActionProfile>;
 
 using Uuid = velecs::common::Uuid;
 
+/// @struct InputEventStats
+/// @brief Per-category event counts reported by Input::ProcessEvents()
+struct InputEventStats {
+    /// @brief Keyboard key and keyboard device events consumed
+    std::size_t keyboardEvents{0};
+
+    /// @brief Mouse motion, button, wheel and device events consumed
+    std::size_t mouseEvents{0};
+
+    /// @brief Gamepad events consumed
+    std::size_t gamepadEvents{0};
+
+    /// @brief Events outside the input categories, skipped without processing
+    std::size_t otherEvents{0};
+
+    /// @brief Mouse motion events folded into a single position and delta update
+    /// @note Included in mouseEvents
+    std::size_t coalescedMotionEvents{0};
+
+    /// @brief Gets the number of input events consumed across every category
+    /// @return keyboardEvents + mouseEvents + gamepadEvents
+    inline std::size_t GetConsumedCount() const { return keyboardEvents + mouseEvents + gamepadEvents; }
+};
+
+/// @struct InputUpdateStats
+/// @brief Timings of the most recent Input::Update()
+struct InputUpdateStats {
+    /// @brief Time spent computing edges and evaluating bindings, in nanoseconds
+    /// @note With immediate dispatch this includes every callback, since they run inline
+    uint64_t evaluationNs{0};
+
+    /// @brief Time spent invoking queued callbacks, in nanoseconds
+    /// @note Always 0 with immediate dispatch
+    uint64_t dispatchNs{0};
+
+    /// @brief Number of queued events invoked
+    /// @note Always 0 with immediate dispatch
+    std::size_t dispatchedEvents{0};
+};
+
 /// @class Input
 /// @brief Brief description.
 ///
@@ -53,19 +107,183 @@ public:
     /// @note Called by velecs-engine for each event in the SDL event queue
     static void ProcessEvent(const SDL_Event* const event);
 
+    /// @brief Processes a contiguous array of SDL events in grouped passes
+    /// @param events Pointer to the first event, typically filled by SDL_PeepEvents()
+    /// @param count Number of events in the array
+    /// @return How many events were consumed per category
+    /// @note Equivalent to calling ProcessEvent() on each event, except that consecutive mouse
+    ///       motion and wheel events are coalesced into one update, applied before the next
+    ///       mouse button event. Events are applied keyboard first, then mouse, then gamepad.
+    ///       Order within a category is kept.
+    /// @code
+    /// SDL_Event events[256];
+    /// int count;
+    /// while ((count = SDL_PeepEvents(events, 256, SDL_GETEVENT, SDL_EVENT_FIRST, SDL_EVENT_LAST)) > 0)
+    /// {
+    ///     Input::ProcessEvents(events, static_cast<std::size_t>(count));
+    /// }
+    /// @endcode
+    static InputEventStats ProcessEvents(const SDL_Event* const events, const std::size_t count);
+
     /// @brief Updates input state transitions and triggers action callbacks
     /// @note Call once per frame after all ProcessEvent calls to finalize input state.
     ///       Compares previous and current frame states to determine Started/Performed/Canceled transitions.
     ///       Must be called before accessing action states for the current frame.
     static void Update();
 
+    /// @brief Switches Update() between walking the profile tree and running a compiled program
+    /// @param enabled true to evaluate bindings from a flat BindingProgram
+    /// @note The program is rebuilt lazily on the first Update() after any profile, map,
+    ///       action or binding is added, and after compiled update is switched back on.
+    ///       Callbacks fire identically in both modes.
+    /// @see BindingProgram
+    static void SetCompiledUpdate(const bool enabled);
+
+    /// @brief Checks if Update() runs the compiled binding program
+    /// @return true if compiled update is enabled
+    inline static bool IsCompiledUpdateEnabled() { return _compiledUpdate; }
+
+    /// @brief Switches Update() between invoking action events inline and queueing them
+    /// @param enabled true to record events during evaluation and invoke them in one
+    ///        batch once every binding has been evaluated
+    /// @note Handlers run at the same point of Update() either way, but deferred handlers
+    ///       never run while profiles are being walked, so they may modify profiles
+    /// @see ActionEventQueue
+    static void SetDeferredDispatch(const bool enabled);
+
+    /// @brief Checks if Update() queues action events instead of invoking them inline
+    /// @return true if deferred dispatch is enabled
+    inline static bool IsDeferredDispatchEnabled() { return _deferredDispatch; }
+
+    /// @brief Sets the order queued events are invoked in when dispatch is deferred
+    /// @param order Recorded to match immediate dispatch, GroupedByAction to invoke each
+    ///        action's events back to back
+    inline static void SetDispatchOrder(const ActionEventQueue::DispatchOrder order) { _dispatchOrder = order; }
+
+    /// @brief Gets the timings of the most recent Update()
+    /// @return Evaluation and dispatch times, measured separately
+    inline static const InputUpdateStats& GetUpdateStats() { return _updateStats; }
+
+    /// @brief Checks if a key was pressed during the most recent Update()
+    /// @param scancode The SDL scancode to check
+    /// @return true if the key went down this frame, false otherwise
+    /// @note Reads the edge masks computed once per frame in Update()
     static bool IsKeyStarted(const SDL_Scancode scancode);
+
+    /// @brief Checks if a key is currently held down
+    /// @param scancode The SDL scancode to check
+    /// @return true if the key is currently pressed, false otherwise
     static bool IsKeyPerformed(const SDL_Scancode scancode);
+
+    /// @brief Checks if a key was released during the most recent Update()
+    /// @param scancode The SDL scancode to check
+    /// @return true if the key went up this frame, false otherwise
+    /// @note Reads the edge masks computed once per frame in Update()
     static bool IsKeyCancelled(const SDL_Scancode scancode);
 
+    /// @brief Checks if a key was pressed on a specific keyboard during the most recent Update()
+    /// @param keyboardId SDL keyboard instance id, or 0 for any keyboard
+    /// @param scancode The SDL scancode to check
+    /// @return true if the key went down on that keyboard this frame, false otherwise
+    static bool IsKeyStarted(const SDL_KeyboardID keyboardId, const SDL_Scancode scancode);
+
+    /// @brief Checks if a key is currently held down on a specific keyboard
+    /// @param keyboardId SDL keyboard instance id, or 0 for any keyboard
+    /// @param scancode The SDL scancode to check
+    /// @return true if the key is held on that keyboard, false otherwise
+    static bool IsKeyPerformed(const SDL_KeyboardID keyboardId, const SDL_Scancode scancode);
+
+    /// @brief Checks if a key was released on a specific keyboard during the most recent Update()
+    /// @param keyboardId SDL keyboard instance id, or 0 for any keyboard
+    /// @param scancode The SDL scancode to check
+    /// @return true if the key went up on that keyboard this frame, false otherwise
+    static bool IsKeyCancelled(const SDL_KeyboardID keyboardId, const SDL_Scancode scancode);
+
+    /// @brief Checks if a gamepad button was pressed during the most recent Update()
+    /// @param gamepadId SDL joystick instance id, or 0 for any gamepad
+    /// @param button The SDL gamepad button to check
+    /// @return true if the button went down this frame, false otherwise
+    static bool IsGamepadButtonStarted(const SDL_JoystickID gamepadId, const SDL_GamepadButton button);
+
+    /// @brief Checks if a gamepad button is currently held
+    /// @param gamepadId SDL joystick instance id, or 0 for any gamepad
+    /// @param button The SDL gamepad button to check
+    /// @return true if the button is held, false otherwise
+    static bool IsGamepadButtonPerformed(const SDL_JoystickID gamepadId, const SDL_GamepadButton button);
+
+    /// @brief Checks if a gamepad button was released during the most recent Update()
+    /// @param gamepadId SDL joystick instance id, or 0 for any gamepad
+    /// @param button The SDL gamepad button to check
+    /// @return true if the button went up this frame, false otherwise
+    static bool IsGamepadButtonCancelled(const SDL_JoystickID gamepadId, const SDL_GamepadButton button);
+
+    /// @brief Gets the current value of a gamepad axis
+    /// @param gamepadId SDL joystick instance id, or 0 for the largest magnitude across all gamepads
+    /// @param axis The SDL gamepad axis to read
+    /// @return The normalized axis value, or 0.0 if the gamepad is not connected
+    static float GetGamepadAxis(const SDL_JoystickID gamepadId, const SDL_GamepadAxis axis);
+
+    /// @brief Checks if a mouse button was pressed during the most recent Update()
+    /// @param button SDL mouse button index (SDL_BUTTON_LEFT, SDL_BUTTON_RIGHT, ...)
+    /// @return true if the button went down this frame, false otherwise
+    static bool IsMouseButtonStarted(const uint8_t button);
+
+    /// @brief Checks if a mouse button is currently held
+    /// @param button SDL mouse button index (SDL_BUTTON_LEFT, SDL_BUTTON_RIGHT, ...)
+    /// @return true if the button is held, false otherwise
+    static bool IsMouseButtonPerformed(const uint8_t button);
+
+    /// @brief Checks if a mouse button was released during the most recent Update()
+    /// @param button SDL mouse button index (SDL_BUTTON_LEFT, SDL_BUTTON_RIGHT, ...)
+    /// @return true if the button went up this frame, false otherwise
+    static bool IsMouseButtonCancelled(const uint8_t button);
+
+    /// @brief Gets the last reported cursor position
+    /// @return Position in window coordinates
+    static velecs::math::Vec2 GetMousePosition();
+
+    /// @brief Gets the relative mouse motion summed over the most recent Update()
+    /// @return Motion in SDL's relative units, +x right and +y down
+    static velecs::math::Vec2 GetMouseDelta();
+
+    /// @brief Gets the wheel scroll summed over the most recent Update()
+    /// @return Scroll amount, +x right and +y away from the user
+    static velecs::math::Vec2 GetMouseWheel();
+
+    /// @brief Gets every motion sensor reading a gamepad reported during the most recent Update()
+    /// @param gamepadId SDL joystick instance id, or 0 for the first connected gamepad
+    /// @param sensor Which sensor stream to read
+    /// @return Zero-copy view of the frame's samples, oldest first
+    /// @note Sensors must be enabled with SDL_SetGamepadSensorEnabled() to produce samples
+    /// @code
+    /// for (const SensorSample& sample : Input::GetGamepadSensorSamples(padId, GamepadSensor::Gyro)) { /* integrate */ }
+    /// @endcode
+    static SampleSpan<SensorSample> GetGamepadSensorSamples(const SDL_JoystickID gamepadId, const GamepadSensor sensor);
+
+    /// @brief Gets every touchpad event a gamepad reported during the most recent Update()
+    /// @param gamepadId SDL joystick instance id, or 0 for the first connected gamepad
+    /// @return Zero-copy view of the frame's samples, oldest first
+    static SampleSpan<TouchpadSample> GetGamepadTouchpadSamples(const SDL_JoystickID gamepadId);
+
+    /// @brief Gets every key pressed during the most recent Update()
+    /// @return Bitset view that iterates only the started scancodes
+    /// @code
+    /// for (SDL_Scancode scancode : Input::GetStartedKeys()) { /* rebind to scancode */ }
+    /// @endcode
+    static const KeyBitset& GetStartedKeys();
+
+    /// @brief Gets every key currently held down
+    /// @return Bitset view that iterates only the held scancodes
+    static const KeyBitset& GetPerformedKeys();
+
+    /// @brief Gets every key released during the most recent Update()
+    /// @return Bitset view that iterates only the cancelled scancodes
+    static const KeyBitset& GetCancelledKeys();
+
     /// @brief Creates a new input profile
     /// @param name Unique name for the profile
-    /// @throws std::runtime_error if profile with same name already exists
+    /// @throws std::runtime_error if profile with same name already exists, or another
+    ///         profile's name has the same NameKey
     static ActionProfile& CreateProfile(const std::string& name);
 
     /// @brief Attempts to retrieve an existing input profile by UUID
@@ -86,6 +304,60 @@ public:
         return _profiles.TryGetRef(name, outProfile);
     }
 
+    /// @brief Attempts to retrieve an existing input profile by the key of its name
+    /// @param key Key of the profile's name, typically a constexpr NameKey
+    /// @param outProfile Reference to store the profile if found
+    /// @return true if profile was found and outProfile was set, false otherwise
+    /// @note Does not build a string or hash at runtime, suitable for per-frame lookups
+    inline static bool TryGetProfile(const NameKey key, ActionProfile*& outProfile)
+    {
+        return _profileKeys.TryGet(key, outProfile);
+    }
+
+    /// @brief Creates or updates every profile stored in a precompiled profile image
+    ///
+    /// Profiles, maps and actions that do not exist yet are created. Existing ones are
+    /// updated in place, so ActionHandles and subscribed handlers stay valid. The image is
+    /// authoritative for the profiles it lists: their maps and actions it does not list
+    /// are disabled, and an action whose bindings differ has them replaced. If that action
+    /// was active, it dispatches cancelled first so handlers see the release, and starts
+    /// again on the next frame its new bindings are held.
+    ///
+    /// @param image A validated image, see ProfileImage
+    /// @throws std::runtime_error if a name collides or repeats (see CheckLoad()), in which
+    ///         case nothing is changed
+    /// @note No configurators run, each record is handed to its object as-is
+    static void LoadProfiles(const ProfileImage& image);
+
+    /// @brief Memory-maps a precompiled profile file and creates or updates every profile it stores
+    /// @param path Path of a file written by ProfileCompiler
+    /// @throws std::runtime_error if the file cannot be mapped or is invalid
+    static void LoadProfiles(const std::string& path);
+
+    /// @brief Loads a profile file now and reloads it whenever it changes
+    ///
+    /// The file is recompiled on a background thread (see ProfileWatcher), and the result
+    /// is applied with LoadProfiles() at the start of the next Update(), so a frame never
+    /// sees half of a reload and never waits on compilation.
+    ///
+    /// @param path The file, in the text authoring format or precompiled
+    /// @throws std::runtime_error if the initial load fails, later failures keep the last
+    ///         good profiles and are reported by GetProfileWatcher()
+    /// @note Replaces any file already being watched
+    static void WatchProfiles(const std::string& path);
+
+    /// @brief Stops watching the profile file, the loaded profiles stay in place
+    static void StopWatchingProfiles();
+
+    /// @brief Gets the active profile file watcher
+    /// @return The watcher, or nullptr if no file is being watched
+    static const ProfileWatcher* GetProfileWatcher();
+
+    /// @brief Serializes every profile into the precompiled profile format
+    /// @return Bytes for ProfileCompiler::WriteFile() or ProfileImage
+    /// @throws std::runtime_error if a binding is not of a built-in type
+    static std::vector<uint8_t> SerializeProfiles();
+
     static void CreateDefaultProfile();
 
 protected:
@@ -94,13 +366,80 @@ protected:
     // Protected Methods
 
 private:
+    // Private Enums
+
+    /// @brief Input subsystem an SDL event type belongs to
+    enum class EventCategory : uint8_t {
+        Keyboard,
+        Mouse,
+        Gamepad,
+        Other,
+    };
+
     // Private Fields
 
     static InputPollingState _state;
 
     static ActionProfileRegistry _profiles;
 
+    /// @brief _profiles indexed by NameKey
+    static NameKeyIndex<ActionProfile> _profileKeys;
+
+    /// @brief Flattened form of _profiles used when compiled update is enabled
+    static BindingProgram _program;
+
+    /// @brief Whether Update() runs _program instead of walking _profiles
+    static bool _compiledUpdate;
+
+    /// @brief Events recorded during evaluation while deferred dispatch is enabled
+    static ActionEventQueue _eventQueue;
+
+    /// @brief Whether action events go through _eventQueue
+    static bool _deferredDispatch;
+
+    /// @brief Order _eventQueue is flushed in
+    static ActionEventQueue::DispatchOrder _dispatchOrder;
+
+    /// @brief Timings of the most recent Update()
+    static InputUpdateStats _updateStats;
+
+    /// @brief Watcher of the file given to WatchProfiles(), null when not watching
+    static std::unique_ptr<ProfileWatcher> _profileWatcher;
+
     // Private Methods
+
+    /// @brief Makes a map match one of an image's map records
+    /// @param image The image being loaded
+    /// @param mapIndex Index of the map's record in the image
+    /// @param map The map to update
+    static void LoadMap(const ProfileImage& image, const uint32_t mapIndex, ActionMap& map);
+
+    /// @brief Checks that loading an image cannot fail part way through
+    /// @param image The image about to be loaded
+    /// @throws std::runtime_error if a name the image would add has the same NameKey as
+    ///         another name, or an action lists two bindings of the same name
+    /// @note Runs before anything is changed, so a failed load leaves the profiles as they were
+    static void CheckLoad(const ProfileImage& image);
+
+    /// @brief Makes an action match one of an image's action records
+    /// @param image The image being loaded
+    /// @param actionIndex Index of the action's record in the image
+    /// @param action The action to update
+    static void LoadAction(const ProfileImage& image, const uint32_t actionIndex, Action& action);
+
+    /// @brief Maps an SDL event type to the subsystem that handles it
+    /// @param type SDL_EventType value
+    /// @return The event's category
+    static EventCategory ClassifyEvent(const uint32_t type);
+
+    /// @brief Applies a keyboard key or keyboard device event
+    static void ProcessKeyboardEvent(const SDL_Event* const event);
+
+    /// @brief Applies a mouse motion, button or wheel event
+    static void ProcessMouseEvent(const SDL_Event* const event);
+
+    /// @brief Applies a gamepad axis, button, device, touchpad or sensor event
+    static void ProcessGamepadEvent(const SDL_Event* const event);
 };
 
 } // namespace velecs::input
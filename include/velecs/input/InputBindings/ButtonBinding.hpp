@@ -12,6 +12,8 @@
 
 #include "velecs/input/InputBindings/InputBinding.hpp"
 
+#include <SDL3/SDL_keyboard.h>
+
 namespace velecs::input {
 
 /// @class ButtonBinding
@@ -20,17 +22,35 @@ namespace velecs::input {
 /// Monitors a specific SDL scancode and reports Started/Performed/Cancelled states
 /// based on key press and release events. Essential building block for button-based
 /// input actions like jump, fire, interact, etc.
-class ButtonBinding : public InputBinding {
+///
+/// By default the binding reacts to the key on any keyboard. Giving it a keyboard id
+/// restricts it to that device, which lets several players share one machine.
+///
+/// The class is final and its configuration is a plain Data struct, so BindingProgram
+/// can copy it into a contiguous array and evaluate it without a virtual call.
+class ButtonBinding final : public InputBinding {
 public:
     // Enums
 
     // Public Fields
 
+    /// @struct Data
+    /// @brief Plain configuration of a ButtonBinding
+    struct Data {
+        /// @brief The SDL scancode to monitor
+        SDL_Scancode scancode;
+
+        /// @brief The keyboard to listen to, 0 for any keyboard
+        SDL_KeyboardID keyboardId;
+    };
+
     // Constructors and Destructors
 
     /// @brief Constructs a ButtonBinding for the specified scancode
     /// @param scancode SDL scancode to monitor for input events
-    inline explicit ButtonBinding(SDL_Scancode scancode) : _scancode(scancode) {}
+    /// @param keyboardId SDL keyboard instance id to listen to, or 0 for any keyboard
+    inline explicit ButtonBinding(SDL_Scancode scancode, SDL_KeyboardID keyboardId = 0)
+        : _data{scancode, keyboardId} {}
 
     /// @brief Default constructor is deleted - ButtonBinding requires params
     ButtonBinding() = delete;
@@ -42,9 +62,31 @@ public:
 
     Status ProcessStatus(const InputPollingState& state, InputBindingContext& outContext) const override;
 
+    /// @brief Evaluates a ButtonBinding from its plain configuration
+    /// @param data The binding's configuration
+    /// @param state Input state for the frame being evaluated
+    /// @param outContext Receives the binding's value and metadata
+    /// @return The binding's status this frame
+    static Status Evaluate(const Data& data, const InputPollingState& state, InputBindingContext& outContext);
+
+    /// @brief Gets the plain configuration of this binding
+    /// @return The binding's Data
+    const Data& GetData() const { return _data; }
+
+    bool CollectKeys(KeyBitset& outKeys) const override;
+
     /// @brief Gets the SDL scancode this binding monitors
     /// @return The scancode this binding is configured for
-    SDL_Scancode GetScancode() const { return _scancode; }
+    SDL_Scancode GetScancode() const { return _data.scancode; }
+
+    /// @brief Gets the keyboard this binding listens to
+    /// @return SDL keyboard instance id, or 0 for any keyboard
+    SDL_KeyboardID GetKeyboardId() const { return _data.keyboardId; }
+
+    /// @brief Restricts this binding to a keyboard
+    /// @param keyboardId SDL keyboard instance id, or 0 for any keyboard
+    /// @note Keyboard ids are assigned by SDL at runtime, typically from SDL_EVENT_KEYBOARD_ADDED
+    void SetKeyboardId(SDL_KeyboardID keyboardId);
 
 protected:
     // Protected Fields
@@ -54,8 +96,8 @@ protected:
 private:
     // Private Fields
 
-    /// @brief The SDL scancode this binding monitors for input
-    const SDL_Scancode _scancode;
+    /// @brief The scancode and keyboard this binding monitors
+    Data _data;
 
     // Private Methods
 };
@@ -12,3 +12,5 @@
 
 #include "velecs/input/InputBindings/ButtonBinding.hpp"
 #include "velecs/input/InputBindings/Vec2Binding.hpp"
+#include "velecs/input/InputBindings/MouseButtonBinding.hpp"
+#include "velecs/input/InputBindings/MouseDeltaBinding.hpp"
@@ -19,6 +19,7 @@ namespace velecs::input {
 
 struct InputPollingState;
 struct PollingData;
+struct KeyBitset;
 
 /// @class InputBinding
 /// @brief Brief description.
@@ -44,6 +45,13 @@ public:
 
     virtual Status ProcessStatus(const InputPollingState& state, InputBindingContext& outContext) const = 0;
 
+    /// @brief Reports the keys this binding reads
+    /// @param outKeys Receives a bit for every scancode the binding depends on
+    /// @return true if the binding reads nothing but those keys and is Idle whenever they are
+    ///         unchanged and it was not Performed last frame; false to be evaluated every frame
+    /// @note Used by BindingProgram to skip bindings untouched by the frame's key changes
+    virtual bool CollectKeys(KeyBitset& /*outKeys*/) const { return false; }
+
 protected:
     // Protected Fields
 
@@ -15,22 +15,50 @@
 #include <SDL3/SDL_scancode.h>
 #include <SDL3/SDL_keycode.h>
 
+#include <cstdint>
+
 namespace velecs::input {
 
+/// @struct InputBindingDetails
+/// @brief Cold metadata of a binding event, kept out of InputBindingContext
+///
+/// Most handlers only read the value and modifiers, so timing and device data live in a
+/// separate struct the context points to. The evaluator provides the storage, and the
+/// pointer is only valid for the duration of the handler call.
+struct InputBindingDetails {
+    /// @brief SDL event timestamp, in nanoseconds, of the press that activated this binding
+    /// @note For Vec2Binding this is the earliest press among the active keys
+    /// @note Bindings filtered to one keyboard report that keyboard's press, not the merged one
+    /// @note 0 when the binding is not held
+    uint64_t pressTimestampNs{0};
+
+    /// @brief How long the binding has been held, in nanoseconds
+    /// @note Measured up to the frame timestamp while held, or up to the release on the
+    ///       frame the binding is cancelled
+    uint64_t holdDurationNs{0};
+
+    /// @brief SDL instance id of the device the binding reads, 0 for any device
+    uint32_t deviceId{0};
+};
+
 /// @struct InputBindingContext
 /// @brief Context data passed with input binding events containing processed values and metadata
 ///
 /// Contains the processed output from input bindings along with contextual information like
-/// active modifier keys and scancodes. Different binding types populate different value fields:
-/// - ButtonBinding sets boolVal and valueType to Bool
-/// - Vec2Binding sets vec2Val and valueType to Vec2  
-/// - Future AnalogBinding would set floatVal and valueType to Float
+/// active modifier keys and scancodes. Different binding types store different values:
+/// - ButtonBinding and MouseButtonBinding store a Bool
+/// - Vec2Binding and MouseDeltaBinding store a Vec2
+/// - Future AnalogBinding would store a Float
+///
+/// The value is a tagged union and scancodes are stored in 16 bits, which keeps the
+/// struct at 24 bytes. Timing and device data are reached through GetDetails(). Action
+/// events pass the context by const reference, so handlers never copy it.
 ///
 /// @code
 /// action.performed += [](const InputBindingContext& ctx) {
 ///     if (ctx.IsVec2()) {
 ///         Vec2 movement = ctx.GetVec2();
-///         if (ctx.activeModifiers & ModifierKey::Shift) {
+///         if (ctx.HasAnyModifiers(SDL_KMOD_SHIFT)) {
 ///             movement *= 2.0f; // Sprint multiplier
 ///         }
 ///         player.Move(movement);
@@ -45,42 +73,29 @@ public:
     // Enums
     
     /// @enum ValueType
-    /// @brief Indicates which value field contains meaningful data from the binding
-    enum class ValueType
+    /// @brief Indicates which value the context holds
+    enum class ValueType : uint8_t
     {
         None,   ///< No meaningful value (default/uninitialized state)
-        Bool,   ///< boolVal contains meaningful data (from ButtonBinding)
-        Float,  ///< floatVal contains meaningful data (reserved for future AnalogBinding)
-        Vec2,   ///< vec2Val contains meaningful data (from Vec2Binding)
+        Bool,   ///< GetBool() is meaningful (from ButtonBinding)
+        Float,  ///< GetFloat() is meaningful (reserved for future AnalogBinding)
+        Vec2,   ///< GetVec2() is meaningful (from Vec2Binding)
     };
 
     // Public Fields
 
-    /// @brief Boolean value from ButtonBinding (true when button is pressed)
-    /// @note Only meaningful when valueType == ValueType::Bool
-    bool boolVal{false};
+    // Ordered so the pointer, tag, modifiers, value and scancodes pack into 24 bytes
 
-    /// @brief Analog value from future AnalogBinding (0.0 to 1.0 range typically)
-    /// @note Only meaningful when valueType == ValueType::Float
-    /// @note Reserved for future trigger/slider input support
-    float floatVal{0.0f};
+    /// @brief Cold metadata, always provided by Action::Process() and BindingProgram::Execute()
+    /// @note Null for cancels the input system synthesizes, such as on rebind
+    /// @see GetDetails()
+    InputBindingDetails* details{nullptr};
 
-    /// @brief Vector2 value from Vec2Binding (normalized direction vector)
-    /// @note Only meaningful when valueType == ValueType::Vec2
-    /// @note Represents combined input from WASD keys, gamepad stick, etc.
-    Vec2 vec2Val{Vec2::ZERO};
-
-    /// @brief Indicates which value field contains the meaningful data from this binding
+    /// @brief Indicates which value this context holds
+    /// @note Set together with the value by SetBool(), SetFloat() or SetVec2()
     ValueType valueType{ValueType::None};
 
-    /// @brief The primary scancode(s) that triggered this binding event
-    /// @note For ButtonBinding: the single key pressed
-    /// @note For Vec2Binding: combined/representative scancode (implementation detail)
-    /// @note May be SDL_SCANCODE_UNKNOWN for complex multi-key bindings
-    SDL_Scancode activePrimaryScancode{SDL_SCANCODE_UNKNOWN};
-
-    SDL_Scancode activeSecondaryScancode{SDL_SCANCODE_UNKNOWN};
-
+    /// @brief Modifier keys held when the binding was evaluated
     SDL_Keymod activeKeymods{SDL_KMOD_NONE};
 
     // Constructors and Destructors
@@ -109,20 +124,90 @@ public:
     /// @brief Gets the boolean value from this context
     /// @return The boolean value from a ButtonBinding
     /// @note Should only be called when IsBool() returns true
-    /// @warning No bounds checking - caller should verify valueType first
-    inline bool GetBool() const { return boolVal; }
+    /// @warning No type checking - caller should verify valueType first
+    inline bool GetBool() const { return _value.boolVal; }
 
     /// @brief Gets the float value from this context
     /// @return The analog value from a future AnalogBinding
     /// @note Should only be called when IsFloat() returns true
-    /// @warning No bounds checking - caller should verify valueType first
-    inline float GetFloat() const { return floatVal; }
+    /// @warning No type checking - caller should verify valueType first
+    inline float GetFloat() const { return _value.floatVal; }
 
     /// @brief Gets the Vec2 value from this context
     /// @return The vector value from a Vec2Binding (movement, look direction, etc.)
     /// @note Should only be called when IsVec2() returns true
-    /// @warning No bounds checking - caller should verify valueType first
-    inline Vec2 GetVec2() const { return vec2Val; }
+    /// @warning No type checking - caller should verify valueType first
+    inline Vec2 GetVec2() const { return Vec2{_value.vec2Val[0], _value.vec2Val[1]}; }
+
+    /// @brief Stores a boolean value and sets valueType to Bool
+    inline void SetBool(const bool value)
+    {
+        valueType = ValueType::Bool;
+        _value.boolVal = value;
+    }
+
+    /// @brief Stores a float value and sets valueType to Float
+    inline void SetFloat(const float value)
+    {
+        valueType = ValueType::Float;
+        _value.floatVal = value;
+    }
+
+    /// @brief Stores a Vec2 value and sets valueType to Vec2
+    inline void SetVec2(const Vec2& value)
+    {
+        valueType = ValueType::Vec2;
+        _value.vec2Val[0] = value.x;
+        _value.vec2Val[1] = value.y;
+    }
+
+    /// @brief Gets the primary scancode that triggered this binding event
+    /// @return For ButtonBinding the key pressed, for Vec2Binding the active x-axis key,
+    ///         SDL_SCANCODE_UNKNOWN if none
+    inline SDL_Scancode GetPrimaryScancode() const { return static_cast<SDL_Scancode>(_primaryScancode); }
+
+    /// @brief Gets the secondary scancode that triggered this binding event
+    /// @return For Vec2Binding the active y-axis key, SDL_SCANCODE_UNKNOWN otherwise
+    inline SDL_Scancode GetSecondaryScancode() const { return static_cast<SDL_Scancode>(_secondaryScancode); }
+
+    /// @brief Sets the primary scancode
+    inline void SetPrimaryScancode(const SDL_Scancode scancode) { _primaryScancode = static_cast<uint16_t>(scancode); }
+
+    /// @brief Sets the secondary scancode
+    inline void SetSecondaryScancode(const SDL_Scancode scancode) { _secondaryScancode = static_cast<uint16_t>(scancode); }
+
+    /// @brief Gets the cold metadata of this event
+    /// @return The details, or a zeroed instance for a synthesized cancel
+    inline const InputBindingDetails& GetDetails() const
+    {
+        static const InputBindingDetails EMPTY{};
+        return details != nullptr ? *details : EMPTY;
+    }
+
+    /// @brief Gets the exact time the binding was pressed
+    /// @return SDL event timestamp of the activating press in nanoseconds
+    inline uint64_t GetPressTimestamp() const { return GetDetails().pressTimestampNs; }
+
+    /// @brief Gets how long the binding has been held
+    /// @return Hold duration in nanoseconds
+    inline uint64_t GetHoldDuration() const { return GetDetails().holdDurationNs; }
+
+    /// @brief Records press timing, if the evaluator provided details
+    /// @param pressTimestampNs SDL event timestamp of the activating press
+    /// @param holdDurationNs How long the binding has been held
+    inline void SetPressTiming(const uint64_t pressTimestampNs, const uint64_t holdDurationNs)
+    {
+        if (details == nullptr) return;
+        details->pressTimestampNs = pressTimestampNs;
+        details->holdDurationNs = holdDurationNs;
+    }
+
+    /// @brief Records the device the binding reads, if the evaluator provided details
+    /// @param deviceId SDL instance id, 0 for any device
+    inline void SetDeviceId(const uint32_t deviceId)
+    {
+        if (details != nullptr) details->deviceId = deviceId;
+    }
 
     /// @brief Checks if this context contains no meaningful value
     /// @return true if valueType is None (uninitialized or invalid state)
@@ -142,7 +227,7 @@ public:
 
     /// @brief Checks if any modifier keys are currently active
     /// @return true if any modifier keys (Ctrl, Shift, Alt, etc.) are active
-    /// @note Convenience method to check if activeKeymods is not KMOD_NONE
+    /// @note Convenience method to check if activeKeymods is not SDL_KMOD_NONE
     /// @see HasAnyModifiers(SDL_Keymod), HasAllModifiers()
     inline bool HasAnyModifiers() const
     { 
@@ -187,7 +272,23 @@ protected:
 private:
     // Private Fields
 
+    /// @brief Storage for the value, valueType selects the active member
+    /// @note vec2Val comes first so brace initialization zeroes all eight bytes
+    union Value {
+        float vec2Val[2];
+        float floatVal;
+        bool boolVal;
+    };
+
+    Value _value{};
+
+    uint16_t _primaryScancode{SDL_SCANCODE_UNKNOWN};
+    uint16_t _secondaryScancode{SDL_SCANCODE_UNKNOWN};
+
     // Private Methods
 };
 
+static_assert(SDL_SCANCODE_COUNT <= 0xFFFF, "InputBindingContext stores scancodes in 16 bits");
+static_assert(sizeof(void*) != 8 || sizeof(InputBindingContext) == 24, "InputBindingContext no longer packs into 24 bytes");
+
 } // namespace velecs::input
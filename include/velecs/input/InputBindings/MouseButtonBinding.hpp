@@ -0,0 +1,85 @@
+/// @file    MouseButtonBinding.hpp
+/// @author  Matthew Green
+/// @date    2026-10-15 14:31:26
+///
+/// @section LICENSE
+///
+/// Copyright (c) 2026 Matthew Green - All rights reserved
+/// Unauthorized copying of this file, via any medium is strictly prohibited
+/// Proprietary and confidential
+
+#pragma once
+
+#include "velecs/input/InputBindings/InputBinding.hpp"
+
+#include <SDL3/SDL_mouse.h>
+
+#include <cstdint>
+
+namespace velecs::input {
+
+/// @class MouseButtonBinding
+/// @brief Input binding for a single mouse button
+///
+/// Mouse counterpart of ButtonBinding. Reports Started/Performed/Cancelled from the
+/// merged state of every connected mouse and fills a Bool context.
+class MouseButtonBinding final : public InputBinding {
+public:
+    // Enums
+
+    // Public Fields
+
+    /// @struct Data
+    /// @brief Plain configuration of a MouseButtonBinding
+    struct Data {
+        /// @brief The SDL mouse button index to monitor
+        uint8_t button;
+    };
+
+    // Constructors and Destructors
+
+    /// @brief Constructs a MouseButtonBinding for the specified button
+    /// @param button SDL mouse button index (SDL_BUTTON_LEFT, SDL_BUTTON_RIGHT, ...)
+    inline explicit MouseButtonBinding(uint8_t button)
+        : _data{button} {}
+
+    /// @brief Default constructor is deleted - MouseButtonBinding requires params
+    MouseButtonBinding() = delete;
+
+    /// @brief Virtual destructor
+    ~MouseButtonBinding() override = default;
+
+    // Public Methods
+
+    Status ProcessStatus(const InputPollingState& state, InputBindingContext& outContext) const override;
+
+    /// @brief Evaluates a MouseButtonBinding from its plain configuration
+    /// @param data The binding's configuration
+    /// @param state Input state for the frame being evaluated
+    /// @param outContext Receives the binding's value and metadata
+    /// @return The binding's status this frame
+    static Status Evaluate(const Data& data, const InputPollingState& state, InputBindingContext& outContext);
+
+    /// @brief Gets the plain configuration of this binding
+    /// @return The binding's Data
+    const Data& GetData() const { return _data; }
+
+    /// @brief Gets the mouse button this binding monitors
+    /// @return SDL mouse button index
+    uint8_t GetButton() const { return _data.button; }
+
+protected:
+    // Protected Fields
+
+    // Protected Methods
+
+private:
+    // Private Fields
+
+    /// @brief The mouse button this binding monitors
+    const Data _data;
+
+    // Private Methods
+};
+
+} // namespace velecs::input
@@ -0,0 +1,88 @@
+/// @file    MouseDeltaBinding.hpp
+/// @author  Matthew Green
+/// @date    2026-10-15 14:44:50
+///
+/// @section LICENSE
+///
+/// Copyright (c) 2026 Matthew Green - All rights reserved
+/// Unauthorized copying of this file, via any medium is strictly prohibited
+/// Proprietary and confidential
+
+#pragma once
+
+#include "velecs/input/InputBindings/InputBinding.hpp"
+
+namespace velecs::input {
+
+/// @class MouseDeltaBinding
+/// @brief Input binding that reports the frame's relative mouse motion as a Vec2
+///
+/// The value is the sum of every motion event since the previous frame, scaled by the
+/// sensitivity. The binding is Performed on every frame the mouse moved, Started on the
+/// first such frame and Cancelled on the first frame without motion, which suits look
+/// and aim actions.
+class MouseDeltaBinding final : public InputBinding {
+public:
+    // Enums
+
+    // Public Fields
+
+    /// @struct Data
+    /// @brief Plain configuration of a MouseDeltaBinding
+    struct Data {
+        /// @brief Multiplier applied to the raw relative motion
+        float sensitivity;
+
+        /// @brief Whether upward motion is reported as +y
+        bool invertY;
+    };
+
+    // Constructors and Destructors
+
+    /// @brief Constructs a MouseDeltaBinding
+    /// @param sensitivity Multiplier applied to the raw relative motion
+    /// @param invertY true to report upward motion as +y instead of SDL's +y down
+    inline explicit MouseDeltaBinding(float sensitivity = 1.0f, bool invertY = false)
+        : _data{sensitivity, invertY} {}
+
+    /// @brief Virtual destructor
+    ~MouseDeltaBinding() override = default;
+
+    // Public Methods
+
+    Status ProcessStatus(const InputPollingState& state, InputBindingContext& outContext) const override;
+
+    /// @brief Evaluates a MouseDeltaBinding from its plain configuration
+    /// @param data The binding's configuration
+    /// @param state Input state for the frame being evaluated
+    /// @param outContext Receives the binding's value and metadata
+    /// @return The binding's status this frame
+    static Status Evaluate(const Data& data, const InputPollingState& state, InputBindingContext& outContext);
+
+    /// @brief Gets the plain configuration of this binding
+    /// @return The binding's Data
+    const Data& GetData() const { return _data; }
+
+    /// @brief Gets the multiplier applied to the raw relative motion
+    /// @return The sensitivity
+    float GetSensitivity() const { return _data.sensitivity; }
+
+    /// @brief Sets the multiplier applied to the raw relative motion
+    /// @param sensitivity The new sensitivity
+    void SetSensitivity(float sensitivity);
+
+protected:
+    // Protected Fields
+
+    // Protected Methods
+
+private:
+    // Private Fields
+
+    /// @brief Sensitivity and axis orientation of this binding
+    Data _data;
+
+    // Private Methods
+};
+
+} // namespace velecs::input
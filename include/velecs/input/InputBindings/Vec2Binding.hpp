@@ -14,22 +14,35 @@
 
 #include <velecs/math/Vec2.hpp>
 
+#include <SDL3/SDL_keyboard.h>
+
 namespace velecs::input {
 
 /// @class Vec2Binding
 /// @brief Brief description.
 ///
 /// Rest of description.
-class Vec2Binding : public InputBinding {
+class Vec2Binding final : public InputBinding {
 public:
     // Enums
 
     // Public Fields
 
+    /// @struct Data
+    /// @brief Plain configuration of a Vec2Binding
+    struct Data {
+        SDL_Scancode posXScancode;
+        SDL_Scancode negXScancode;
+        SDL_Scancode posYScancode;
+        SDL_Scancode negYScancode;
+        float deadzone;
+        SDL_KeyboardID keyboardId;
+    };
+
     // Constructors and Destructors
 
-    inline explicit Vec2Binding(SDL_Scancode posX, SDL_Scancode negX, SDL_Scancode posY, SDL_Scancode negY, float deadzone)
-        : _posXScancode(posX), _negXScancode(negX), _posYScancode(posY), _negYScancode(negY), _deadzone(deadzone) {}
+    inline explicit Vec2Binding(SDL_Scancode posX, SDL_Scancode negX, SDL_Scancode posY, SDL_Scancode negY, float deadzone, SDL_KeyboardID keyboardId = 0)
+        : _data{posX, negX, posY, negY, deadzone, keyboardId} {}
 
     /// @brief Default constructor is deleted - ButtonBinding requires params
     Vec2Binding() = delete;
@@ -41,23 +54,56 @@ public:
 
     Status ProcessStatus(const InputPollingState& state, InputBindingContext& outContext) const override;
 
+    /// @brief Evaluates a Vec2Binding from its plain configuration
+    /// @param data The binding's configuration
+    /// @param state Input state for the frame being evaluated
+    /// @param outContext Receives the binding's value and metadata
+    /// @return The binding's status this frame
+    /// @note Reads the previous frame's keys when one of the four keys changed. The tree
+    ///       walk stops at an action's first active binding and skips disabled actions,
+    ///       so a binding is not evaluated every frame and cannot carry its last value.
+    ///       The compiled program carries it in Vec2CompositeBatch instead.
+    static Status Evaluate(const Data& data, const InputPollingState& state, InputBindingContext& outContext);
+
+    /// @brief Gets the plain configuration of this binding
+    /// @return The binding's Data
+    const Data& GetData() const { return _data; }
+
+    bool CollectKeys(KeyBitset& outKeys) const override;
+
+    /// @brief Gets the keyboard this binding listens to
+    /// @return SDL keyboard instance id, or 0 for any keyboard
+    SDL_KeyboardID GetKeyboardId() const { return _data.keyboardId; }
+
+    /// @brief Restricts this binding to a keyboard
+    /// @param keyboardId SDL keyboard instance id, or 0 for any keyboard
+    void SetKeyboardId(SDL_KeyboardID keyboardId);
+
 protected:
     // Protected Fields
 
     // Protected Methods
 
 private:
+    friend class Vec2CompositeBatch;
+
     // Private Fields
 
-    SDL_Scancode _posXScancode;
-    SDL_Scancode _negXScancode;
-    SDL_Scancode _posYScancode;
-    SDL_Scancode _negYScancode;
-    float _deadzone;
+    /// @brief The four direction keys, deadzone and keyboard this binding monitors
+    Data _data;
 
     // Private Methods
 
-    velecs::math::Vec2 CalculateVec2(const PollingData& data) const;
+    static velecs::math::Vec2 CalculateVec2(const Data& data, const KeyBitset& keys);
+
+    /// @brief Fills a context from an already computed vector
+    /// @param data The binding's configuration
+    /// @param state Input state for the frame being evaluated
+    /// @param currentKeys The binding keyboard's current key state
+    /// @param value The binding's vector this frame
+    /// @param isPastDeadzone Whether value is past the deadzone
+    /// @param outContext Receives the value, active scancodes and press timing
+    static void FillContext(const Data& data, const InputPollingState& state, const KeyBitset& currentKeys, const velecs::math::Vec2& value, const bool isPastDeadzone, InputBindingContext& outContext);
 };
 
 } // namespace velecs::input
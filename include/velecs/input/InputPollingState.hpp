@@ -11,6 +11,16 @@
 #pragma once
 
 #include "velecs/input/PollingData.hpp"
+#include "velecs/input/DeviceSlotMap.hpp"
+#include "velecs/input/GamepadStreams.hpp"
+
+#include <SDL3/SDL_keyboard.h>
+#include <SDL3/SDL_gamepad.h>
+
+#include <velecs/math/Vec2.hpp>
+
+#include <cstddef>
+#include <cstdint>
 
 namespace velecs::input {
 
@@ -24,21 +34,57 @@ namespace velecs::input {
 /// Key tracking works by:
 /// - Adding keys to current on SDL_KEYDOWN events
 /// - Removing keys from current on SDL_KEYUP events  
-/// - Copying current to previous at frame boundaries
+/// - Recording each key that actually changed in a fixed-size journal
+/// - Swapping the previous and current buffers at frame boundaries and replaying
+///   only the journaled keys into the new current buffer
 /// - Maintaining persistent key state in current between frames
+///
+/// Started and cancelled queries read whole-keyboard edge masks that UpdateEdges()
+/// computes once per frame, so each query is a single bit test regardless of how many
+/// bindings ask.
+///
+/// Every press and release is also counted per key as it arrives, so a key that goes
+/// down and back up between two updates still reports both a started and a cancelled
+/// edge. The counters live in fixed arrays and are reset lazily for only the keys that
+/// changed, so no event ever allocates.
+///
+/// The SDL event timestamp of each key's most recent press and release is kept in two
+/// fixed arrays alongside the key state, giving exact press times and hold durations
+/// instead of frame-quantized ones.
+///
+/// Keys are also tracked per keyboard. Each connected SDL_KeyboardID is assigned a dense
+/// slot (see DeviceSlotMap) so per-device queries are an O(1) id lookup plus a bit test.
+/// Keyboard id 0, which SDL uses for unknown or virtual keyboards, only affects the
+/// merged state and is also how queries ask for "any keyboard".
+///
+/// Gamepads follow the same pattern with their own slot map. Button edges are computed
+/// per pad in UpdateEdges() from the previous and current button masks plus the buttons
+/// pressed and released during the frame, exactly like the keyboard path.
+///
+/// Gamepad motion sensor and touchpad events are not reduced to a latest value. Each
+/// gamepad slot owns GamepadStreams ring buffers that keep every timestamped sample, and
+/// UpdateEdges() latches the samples that arrived during the frame so readers get them
+/// as one contiguous span.
+///
+/// Mouse motion is coalesced as it arrives: each motion event overwrites the absolute
+/// position and adds its relative motion to the frame's running delta, so even a very
+/// high polling rate mouse costs a few float operations per event. Mouse buttons use the
+/// same pressed/released masks and edge computation as gamepad buttons.
 struct InputPollingState {
 public:
     // Enums
 
     // Public Fields
 
-    /// @brief Polling data from the previous frame
-    /// @note Used for detecting input state transitions (started/cancelled events)
-    PollingData previous;
+    /// @brief Maximum number of key changes journaled per frame
+    /// @note If more keys change in a single frame, ShiftFrame falls back to a full buffer copy
+    static constexpr std::size_t MAX_CHANGED_KEYS = 128;
 
-    /// @brief Polling data from the current frame
-    /// @note Contains the most recent input state, persists held keys between frames
-    PollingData current;
+    /// @brief Keyboard id meaning "any keyboard" in per-device queries
+    static constexpr SDL_KeyboardID ANY_KEYBOARD = 0;
+
+    /// @brief Gamepad id meaning "any gamepad" in per-device queries
+    static constexpr SDL_JoystickID ANY_GAMEPAD = 0;
 
     // Constructors and Destructors
 
@@ -64,9 +110,178 @@ public:
 
     // Public Methods
 
-    /// @brief Shifts to the next frame by copying current data to previous
+    /// @brief Gets the polling data from the previous frame
+    /// @return Const reference to the previous frame's polling data
+    /// @note Used for detecting input state transitions (started/cancelled events)
+    /// @note Kept as a full frame rather than per-binding state, because the edge masks,
+    ///       the finished frame's mouse totals, MouseDeltaBinding and the tree walk's
+    ///       Vec2Binding all read it. Only Vec2CompositeBatch carries its own state.
+    inline const PollingData& Previous() const { return _frames[_currentIndex ^ 1u]; }
+
+    /// @brief Gets the polling data from the current frame
+    /// @return Const reference to the current frame's polling data
+    /// @note Contains the most recent input state, persists held keys between frames
+    inline const PollingData& Current() const { return _frames[_currentIndex]; }
+
+    /// @brief Registers a key as pressed in the current frame
+    /// @param scancode The SDL scancode to register as pressed
+    /// @param timestampNs SDL event timestamp of the press in nanoseconds
+    /// @note Only journals the key if its state actually changed, so key repeats are free
+    /// @see UnregisterKey(), ShiftFrame()
+    void RegisterKey(const SDL_Scancode scancode, const uint64_t timestampNs = 0);
+
+    /// @brief Unregisters a key as no longer pressed in the current frame
+    /// @param scancode The SDL scancode to unregister
+    /// @param timestampNs SDL event timestamp of the release in nanoseconds
+    /// @note Only journals the key if its state actually changed
+    /// @see RegisterKey(), ShiftFrame()
+    void UnregisterKey(const SDL_Scancode scancode, const uint64_t timestampNs = 0);
+
+    /// @brief Registers a key as pressed on a specific keyboard in the current frame
+    /// @param keyboardId SDL keyboard instance id the event came from
+    /// @param scancode The SDL scancode to register as pressed
+    /// @param timestampNs SDL event timestamp of the press in nanoseconds
+    /// @note Unknown keyboards are registered on first use; if every slot is taken the key
+    ///       only updates the merged state
+    /// @note Ignored for a keyboard disconnected this frame
+    void RegisterKey(const SDL_KeyboardID keyboardId, const SDL_Scancode scancode, const uint64_t timestampNs = 0);
+
+    /// @brief Unregisters a key as no longer pressed on a specific keyboard in the current frame
+    /// @param keyboardId SDL keyboard instance id the event came from
+    /// @param scancode The SDL scancode to unregister
+    /// @param timestampNs SDL event timestamp of the release in nanoseconds
+    /// @note The merged state keeps the key down while another keyboard still holds it
+    void UnregisterKey(const SDL_KeyboardID keyboardId, const SDL_Scancode scancode, const uint64_t timestampNs = 0);
+
+    /// @brief Assigns a slot to a newly connected keyboard
+    /// @param keyboardId SDL keyboard instance id from SDL_EVENT_KEYBOARD_ADDED
+    /// @return The assigned slot, or DeviceSlotMap::INVALID_SLOT if every slot is in use or
+    ///         the keyboard was disconnected this frame
+    int RegisterKeyboard(const SDL_KeyboardID keyboardId);
+
+    /// @brief Releases every key held on a disconnected keyboard and frees its slot
+    /// @param keyboardId SDL keyboard instance id from SDL_EVENT_KEYBOARD_REMOVED
+    /// @param timestampNs SDL event timestamp of the removal in nanoseconds
+    /// @note The slot is freed by the next ShiftFrame(), so queries by keyboardId still see
+    ///       the released keys as cancelled this frame, and a keyboard connected in the
+    ///       same frame cannot inherit them
+    void UnregisterKeyboard(const SDL_KeyboardID keyboardId, const uint64_t timestampNs = 0);
+
+    /// @brief Resolves a keyboard id to its slot in PollingData::keyboardKeys
+    /// @param keyboardId SDL keyboard instance id, or ANY_KEYBOARD
+    /// @return The keyboard's slot, PollingData::ANY_KEYBOARD_SLOT for ANY_KEYBOARD, or
+    ///         DeviceSlotMap::INVALID_SLOT if the keyboard is not connected
+    inline int GetKeyboardSlot(const SDL_KeyboardID keyboardId) const
+    {
+        if (keyboardId == ANY_KEYBOARD) return PollingData::ANY_KEYBOARD_SLOT;
+        return _keyboards.Find(keyboardId);
+    }
+
+    /// @brief Assigns a slot to a newly connected gamepad and clears its state
+    /// @param gamepadId SDL joystick instance id from SDL_EVENT_GAMEPAD_ADDED
+    /// @return The assigned slot, or DeviceSlotMap::INVALID_SLOT if every slot is in use or
+    ///         the gamepad was disconnected this frame
+    int RegisterGamepad(const SDL_JoystickID gamepadId);
+
+    /// @brief Releases every button on a disconnected gamepad, zeroes its axes and frees its slot
+    /// @param gamepadId SDL joystick instance id from SDL_EVENT_GAMEPAD_REMOVED
+    /// @note The slot is freed by the next ShiftFrame(), so queries by gamepadId still see
+    ///       the released buttons as cancelled this frame, and a gamepad connected in the
+    ///       same frame cannot inherit them
+    void UnregisterGamepad(const SDL_JoystickID gamepadId);
+
+    /// @brief Registers a gamepad button as pressed in the current frame
+    /// @param gamepadId SDL joystick instance id the event came from
+    /// @param button The SDL gamepad button that went down
+    /// @note Unknown gamepads are registered on first use
+    void RegisterGamepadButton(const SDL_JoystickID gamepadId, const SDL_GamepadButton button);
+
+    /// @brief Unregisters a gamepad button as no longer pressed in the current frame
+    /// @param gamepadId SDL joystick instance id the event came from
+    /// @param button The SDL gamepad button that went up
+    void UnregisterGamepadButton(const SDL_JoystickID gamepadId, const SDL_GamepadButton button);
+
+    /// @brief Stores the latest value of a gamepad axis in the current frame
+    /// @param gamepadId SDL joystick instance id the event came from
+    /// @param axis The SDL gamepad axis that moved
+    /// @param value Normalized axis value
+    /// @note Unknown gamepads are registered on first use
+    void RegisterGamepadAxis(const SDL_JoystickID gamepadId, const SDL_GamepadAxis axis, const float value);
+
+    /// @brief Appends a motion sensor reading to a gamepad's sensor stream
+    /// @param gamepadId SDL joystick instance id the event came from
+    /// @param sensor Which sensor stream receives the sample
+    /// @param sample The timestamped sensor reading
+    /// @note Unknown gamepads are registered on first use
+    void RegisterGamepadSensor(const SDL_JoystickID gamepadId, const GamepadSensor sensor, const SensorSample& sample);
+
+    /// @brief Appends a touchpad finger event to a gamepad's touchpad stream
+    /// @param gamepadId SDL joystick instance id the event came from
+    /// @param sample The timestamped touchpad event
+    /// @note Unknown gamepads are registered on first use
+    void RegisterGamepadTouchpad(const SDL_JoystickID gamepadId, const TouchpadSample& sample);
+
+    /// @brief Resolves a gamepad id to its slot in PollingData's gamepad arrays
+    /// @param gamepadId SDL joystick instance id
+    /// @return The gamepad's slot, or DeviceSlotMap::INVALID_SLOT if it is not connected
+    inline int GetGamepadSlot(const SDL_JoystickID gamepadId) const { return _gamepads.Find(gamepadId); }
+
+    /// @brief Accumulates a mouse motion event into the current frame
+    /// @param x Absolute cursor x in window coordinates
+    /// @param y Absolute cursor y in window coordinates
+    /// @param deltaX Relative motion along x since the previous motion event
+    /// @param deltaY Relative motion along y since the previous motion event
+    inline void RegisterMouseMotion(const float x, const float y, const float deltaX, const float deltaY)
+    {
+        PollingData& current = _frames[_currentIndex];
+        current.mouseX = x;
+        current.mouseY = y;
+        current.mouseDeltaX += deltaX;
+        current.mouseDeltaY += deltaY;
+    }
+
+    /// @brief Accumulates a mouse wheel event into the current frame
+    /// @param deltaX Horizontal scroll amount, positive to the right
+    /// @param deltaY Vertical scroll amount, positive away from the user
+    inline void RegisterMouseWheel(const float deltaX, const float deltaY)
+    {
+        PollingData& current = _frames[_currentIndex];
+        current.mouseWheelX += deltaX;
+        current.mouseWheelY += deltaY;
+    }
+
+    /// @brief Registers a mouse button as pressed in the current frame
+    /// @param button SDL mouse button index (SDL_BUTTON_LEFT, SDL_BUTTON_RIGHT, ...)
+    /// @param timestampNs SDL event timestamp of the press in nanoseconds
+    void RegisterMouseButton(const uint8_t button, const uint64_t timestampNs = 0);
+
+    /// @brief Unregisters a mouse button as no longer pressed in the current frame
+    /// @param button SDL mouse button index (SDL_BUTTON_LEFT, SDL_BUTTON_RIGHT, ...)
+    void UnregisterMouseButton(const uint8_t button);
+
+    /// @brief Sets the modifier key state for the current frame
+    /// @param keymods The SDL_Keymod flags, typically from SDL_GetModState()
+    inline void SetKeymods(const SDL_Keymod keymods) { _frames[_currentIndex].keymods = keymods; }
+
+    /// @brief Sets the timestamp of the frame being evaluated
+    /// @param timestampNs Frame time in nanoseconds, on the same clock as SDL event timestamps
+    /// @note Used as the end point of hold durations for keys that are still held
+    inline void SetFrameTimestamp(const uint64_t timestampNs) { _frameTimestampNs = timestampNs; }
+
+    /// @brief Gets the timestamp of the frame being evaluated
+    /// @return Frame time in nanoseconds
+    inline uint64_t GetFrameTimestamp() const { return _frameTimestampNs; }
+
+    /// @brief Computes the started and cancelled key masks for the current frame
+    /// @note Should be called once per frame after processing all input events and before
+    ///       any started/cancelled queries. The masks stay valid until the next call.
+    /// @see IsKeyStarted(), IsKeyCancelled()
+    void UpdateEdges();
+
+    /// @brief Shifts to the next frame by swapping buffers and replaying changed keys
     /// @note Should be called once per frame after processing all input events
     /// @note Current frame data is preserved to maintain persistent key states
+    /// @note Costs O(changed keys) and never allocates
     /// @note Use RegisterKey/UnregisterKey to modify current state based on SDL events
     void ShiftFrame();
 
@@ -91,6 +306,183 @@ public:
     /// @see IsKeyStarted(), IsKeyPerformed()
     bool IsKeyCancelled(const SDL_Scancode scancode) const;
 
+    /// @brief Checks if a scancode was just pressed on a specific keyboard this frame
+    /// @param keyboardId SDL keyboard instance id, or ANY_KEYBOARD
+    /// @param scancode The SDL scancode to check
+    /// @return true if the key was pressed on that keyboard this frame, false otherwise
+    bool IsKeyStarted(const SDL_KeyboardID keyboardId, const SDL_Scancode scancode) const;
+
+    /// @brief Checks if a scancode is currently held down on a specific keyboard
+    /// @param keyboardId SDL keyboard instance id, or ANY_KEYBOARD
+    /// @param scancode The SDL scancode to check
+    /// @return true if the key is held on that keyboard, false otherwise
+    bool IsKeyPerformed(const SDL_KeyboardID keyboardId, const SDL_Scancode scancode) const;
+
+    /// @brief Checks if a scancode was just released on a specific keyboard this frame
+    /// @param keyboardId SDL keyboard instance id, or ANY_KEYBOARD
+    /// @param scancode The SDL scancode to check
+    /// @return true if the key was released on that keyboard this frame, false otherwise
+    bool IsKeyCancelled(const SDL_KeyboardID keyboardId, const SDL_Scancode scancode) const;
+
+    /// @brief Checks if a scancode was either pressed or released on a specific keyboard this frame
+    /// @param keyboardId SDL keyboard instance id, or ANY_KEYBOARD
+    /// @param scancode The SDL scancode to check
+    /// @return true if the key's state on that keyboard changed this frame, false otherwise
+    bool IsKeyChanged(const SDL_KeyboardID keyboardId, const SDL_Scancode scancode) const;
+
+    /// @brief Checks if a gamepad button was just pressed this frame
+    /// @param gamepadId SDL joystick instance id, or ANY_GAMEPAD
+    /// @param button The SDL gamepad button to check
+    /// @return true if the button went down this frame, false otherwise
+    bool IsGamepadButtonStarted(const SDL_JoystickID gamepadId, const SDL_GamepadButton button) const;
+
+    /// @brief Checks if a gamepad button is currently held
+    /// @param gamepadId SDL joystick instance id, or ANY_GAMEPAD
+    /// @param button The SDL gamepad button to check
+    /// @return true if the button is held, false otherwise
+    bool IsGamepadButtonPerformed(const SDL_JoystickID gamepadId, const SDL_GamepadButton button) const;
+
+    /// @brief Checks if a gamepad button was just released this frame
+    /// @param gamepadId SDL joystick instance id, or ANY_GAMEPAD
+    /// @param button The SDL gamepad button to check
+    /// @return true if the button went up this frame, false otherwise
+    bool IsGamepadButtonCancelled(const SDL_JoystickID gamepadId, const SDL_GamepadButton button) const;
+
+    /// @brief Gets the current value of a gamepad axis
+    /// @param gamepadId SDL joystick instance id, or ANY_GAMEPAD for the value with the
+    ///        largest magnitude across all connected gamepads
+    /// @param axis The SDL gamepad axis to read
+    /// @return The normalized axis value, or 0.0 if the gamepad is not connected
+    float GetGamepadAxis(const SDL_JoystickID gamepadId, const SDL_GamepadAxis axis) const;
+
+    /// @brief Checks if a mouse button was pressed this frame
+    /// @param button SDL mouse button index
+    /// @return true if the button went down this frame
+    /// @note Valid after UpdateEdges() until the next UpdateEdges() call
+    bool IsMouseButtonStarted(const uint8_t button) const;
+
+    /// @brief Checks if a mouse button is currently held
+    /// @param button SDL mouse button index
+    /// @return true if the button is held
+    bool IsMouseButtonPerformed(const uint8_t button) const;
+
+    /// @brief Checks if a mouse button was released this frame
+    /// @param button SDL mouse button index
+    /// @return true if the button went up this frame
+    /// @note Valid after UpdateEdges() until the next UpdateEdges() call
+    bool IsMouseButtonCancelled(const uint8_t button) const;
+
+    /// @brief Gets the SDL event timestamp of a mouse button's most recent press
+    /// @param button SDL mouse button index
+    /// @return Timestamp in nanoseconds, or 0 if the button has not been pressed
+    uint64_t GetMouseButtonPressTimestamp(const uint8_t button) const;
+
+    /// @brief Gets the last reported cursor position
+    /// @return Position in window coordinates
+    inline velecs::math::Vec2 GetMousePosition() const { return velecs::math::Vec2{Current().mouseX, Current().mouseY}; }
+
+    /// @brief Gets the relative mouse motion summed over the current frame
+    /// @return Motion in SDL's relative units, +x right and +y down
+    inline velecs::math::Vec2 GetMouseDelta() const { return velecs::math::Vec2{Current().mouseDeltaX, Current().mouseDeltaY}; }
+
+    /// @brief Gets the wheel scroll summed over the current frame
+    /// @return Scroll amount, +x right and +y away from the user
+    inline velecs::math::Vec2 GetMouseWheel() const { return velecs::math::Vec2{Current().mouseWheelX, Current().mouseWheelY}; }
+
+    /// @brief Gets every sensor reading a gamepad reported during the frame
+    /// @param gamepadId SDL joystick instance id, or ANY_GAMEPAD for the lowest connected slot
+    /// @param sensor Which sensor stream to read
+    /// @return Contiguous view of the frame's samples, oldest first, empty if the gamepad
+    ///         is not connected
+    /// @note Valid after UpdateEdges() until the next UpdateEdges() call
+    SampleSpan<SensorSample> GetGamepadSensorSamples(const SDL_JoystickID gamepadId, const GamepadSensor sensor) const;
+
+    /// @brief Gets every touchpad event a gamepad reported during the frame
+    /// @param gamepadId SDL joystick instance id, or ANY_GAMEPAD for the lowest connected slot
+    /// @return Contiguous view of the frame's samples, oldest first, empty if the gamepad
+    ///         is not connected
+    /// @note Valid after UpdateEdges() until the next UpdateEdges() call
+    SampleSpan<TouchpadSample> GetGamepadTouchpadSamples(const SDL_JoystickID gamepadId) const;
+
+    /// @brief Gets the keys pressed this frame
+    /// @return Bitset view of started keys, iterable as SDL_Scancode values
+    /// @note Valid after UpdateEdges() until the next UpdateEdges() call
+    inline const KeyBitset& GetStartedKeys() const { return _startedKeys; }
+
+    /// @brief Gets the keys currently held down
+    /// @return Bitset view of performed keys, iterable as SDL_Scancode values
+    inline const KeyBitset& GetPerformedKeys() const { return Current().downKeys; }
+
+    /// @brief Gets the keys released this frame
+    /// @return Bitset view of cancelled keys, iterable as SDL_Scancode values
+    /// @note Valid after UpdateEdges() until the next UpdateEdges() call
+    inline const KeyBitset& GetCancelledKeys() const { return _cancelledKeys; }
+
+    /// @brief Gets how many times a key was pressed this frame
+    /// @param scancode The SDL scancode to check
+    /// @return Number of press transitions, saturating at 255
+    /// @note Valid after UpdateEdges() until the next input event or UpdateEdges() call
+    uint8_t GetKeyPressCount(const SDL_Scancode scancode) const;
+
+    /// @brief Gets how many times a key was released this frame
+    /// @param scancode The SDL scancode to check
+    /// @return Number of release transitions, saturating at 255
+    /// @note Valid after UpdateEdges() until the next input event or UpdateEdges() call
+    uint8_t GetKeyReleaseCount(const SDL_Scancode scancode) const;
+
+    /// @brief Gets the time a key was most recently pressed
+    /// @param scancode The SDL scancode to check
+    /// @return SDL event timestamp of the last press in nanoseconds, or 0 if never pressed
+    uint64_t GetKeyPressTimestamp(const SDL_Scancode scancode) const;
+
+    /// @brief Gets how long a key has been held
+    /// @param scancode The SDL scancode to check
+    /// @return Nanoseconds from the last press to the frame timestamp while held, from the
+    ///         last press to the release if it was released this frame, otherwise 0
+    uint64_t GetKeyHoldDuration(const SDL_Scancode scancode) const;
+
+    /// @brief Gets the time a key was most recently pressed on a specific keyboard
+    /// @param keyboardId SDL keyboard instance id, or ANY_KEYBOARD for the merged state
+    /// @param scancode The SDL scancode to check
+    /// @return SDL event timestamp of that keyboard's last press in nanoseconds, or 0 if
+    ///         never pressed or the keyboard is not connected
+    uint64_t GetKeyPressTimestamp(const SDL_KeyboardID keyboardId, const SDL_Scancode scancode) const;
+
+    /// @brief Gets how long a key has been held on a specific keyboard
+    /// @param keyboardId SDL keyboard instance id, or ANY_KEYBOARD for the merged state
+    /// @param scancode The SDL scancode to check
+    /// @return Same as GetKeyHoldDuration(), measured from that keyboard's press and release
+    uint64_t GetKeyHoldDuration(const SDL_KeyboardID keyboardId, const SDL_Scancode scancode) const;
+
+    /// @brief Checks if a key's first transition this frame was a release
+    /// @param scancode The SDL scancode to check
+    /// @return true if the key was released before it was pressed this frame, false if it
+    ///         was pressed first or did not change
+    /// @note The last transition is always implied by IsKeyPerformed()
+    inline bool IsKeyReleasedFirst(const SDL_Scancode scancode) const { return _releasedFirstKeys.Test(scancode); }
+
+    /// @brief Checks if a scancode was either pressed or released this frame
+    /// @param scancode The SDL scancode to check
+    /// @return true if the key's state differs from the previous frame, false otherwise
+    /// @see IsKeyStarted(), IsKeyCancelled()
+    inline bool IsKeyChanged(const SDL_Scancode scancode) const
+    {
+        return _startedKeys.Test(scancode) || _cancelledKeys.Test(scancode);
+    }
+
+    /// @brief Invokes a function for every key whose state changed on any keyboard this frame
+    /// @param func Callable taking an SDL_Scancode, may see the same scancode more than once
+    /// @return false if too many keys changed to be journaled, in which case func is not
+    ///         called and every key must be treated as changed
+    /// @note Walks the frame's change journal, so the cost is O(changed keys)
+    template<typename Func>
+    inline bool ForEachChangedKey(Func&& func) const
+    {
+        if (_changedKeysOverflowed) return false;
+        for (std::size_t i = 0; i < _changedKeyCount; ++i) func(_changedKeys[i].scancode);
+        return true;
+    }
+
 protected:
     // Protected Fields
 
@@ -99,7 +491,170 @@ protected:
 private:
     // Private Fields
 
+    /// @brief Double-buffered polling data, indexed by _currentIndex and its complement
+    PollingData _frames[2];
+
+    /// @brief Index of the buffer holding the current frame (0 or 1)
+    uint8_t _currentIndex{0};
+
+    /// @struct KeyChange
+    /// @brief Journal entry for a key whose merged or per-keyboard state changed
+    struct KeyChange {
+        /// @brief The scancode that changed
+        SDL_Scancode scancode{SDL_SCANCODE_UNKNOWN};
+
+        /// @brief Keyboard slot whose bit also changed, or DeviceSlotMap::INVALID_SLOT
+        int8_t keyboardSlot{-1};
+    };
+
+    /// @brief Keys whose state changed during the frame
+    /// @note Replayed by ShiftFrame(), then kept until the next frame's first event so the
+    ///       per-key counters can be reset for just these keys
+    KeyChange _changedKeys[MAX_CHANGED_KEYS]{};
+
+    /// @brief Number of valid entries in _changedKeys
+    std::size_t _changedKeyCount{0};
+
+    /// @brief Whether more than MAX_CHANGED_KEYS keys changed this frame
+    bool _changedKeysOverflowed{false};
+
+    /// @brief Whether the journal and counters still describe the frame before the last shift
+    bool _transitionsStale{false};
+
+    /// @brief Press transitions per key this frame
+    uint8_t _keyPressCounts[KeyBitset::BIT_COUNT]{};
+
+    /// @brief Release transitions per key this frame
+    uint8_t _keyReleaseCounts[KeyBitset::BIT_COUNT]{};
+
+    /// @brief Timestamp of the frame being evaluated in nanoseconds
+    uint64_t _frameTimestampNs{0};
+
+    /// @brief SDL event timestamp of each key's most recent press in nanoseconds
+    uint64_t _keyPressTimestamps[KeyBitset::BIT_COUNT]{};
+
+    /// @brief SDL event timestamp of each key's most recent release in nanoseconds
+    uint64_t _keyReleaseTimestamps[KeyBitset::BIT_COUNT]{};
+
+    /// @brief _keyPressTimestamps per keyboard slot, for bindings filtered to one keyboard
+    uint64_t _keyboardPressTimestamps[PollingData::MAX_KEYBOARDS][KeyBitset::BIT_COUNT]{};
+
+    /// @brief _keyReleaseTimestamps per keyboard slot
+    uint64_t _keyboardReleaseTimestamps[PollingData::MAX_KEYBOARDS][KeyBitset::BIT_COUNT]{};
+
+    /// @brief Keys that received at least one press this frame
+    KeyBitset _pressedKeys;
+
+    /// @brief Keys that received at least one release this frame
+    KeyBitset _releasedKeys;
+
+    /// @brief Keys whose first transition this frame was a release
+    KeyBitset _releasedFirstKeys;
+
+    /// @brief Maps connected SDL_KeyboardID values to slots in PollingData::keyboardKeys
+    DeviceSlotMap<PollingData::MAX_KEYBOARDS> _keyboards;
+
+    /// @brief Bit N set if the keyboard in slot N was disconnected this frame, freed by ShiftFrame()
+    uint32_t _removedKeyboardSlots{0};
+
+    /// @brief Keys that received at least one press this frame, per keyboard slot
+    KeyBitset _keyboardPressedKeys[PollingData::MAX_KEYBOARDS];
+
+    /// @brief Keys that received at least one release this frame, per keyboard slot
+    KeyBitset _keyboardReleasedKeys[PollingData::MAX_KEYBOARDS];
+
+    /// @brief Maps connected SDL_JoystickID values to slots in PollingData's gamepad arrays
+    DeviceSlotMap<PollingData::MAX_GAMEPADS> _gamepads;
+
+    /// @brief Bit N set if the gamepad in slot N was disconnected this frame, freed by ShiftFrame()
+    uint32_t _removedGamepadSlots{0};
+
+    /// @brief Buttons that received at least one press this frame, per gamepad slot
+    uint32_t _gamepadPressedButtons[PollingData::MAX_GAMEPADS]{};
+
+    /// @brief Buttons that received at least one release this frame, per gamepad slot
+    uint32_t _gamepadReleasedButtons[PollingData::MAX_GAMEPADS]{};
+
+    /// @brief Buttons pressed this frame per gamepad slot, computed by UpdateEdges()
+    uint32_t _gamepadStartedButtons[PollingData::MAX_GAMEPADS]{};
+
+    /// @brief Buttons released this frame per gamepad slot, computed by UpdateEdges()
+    uint32_t _gamepadCancelledButtons[PollingData::MAX_GAMEPADS]{};
+
+    /// @brief Mouse buttons that received at least one press this frame
+    uint32_t _mousePressedButtons{0};
+
+    /// @brief Mouse buttons that received at least one release this frame
+    uint32_t _mouseReleasedButtons{0};
+
+    /// @brief Mouse buttons pressed this frame, computed by UpdateEdges()
+    uint32_t _mouseStartedButtons{0};
+
+    /// @brief Mouse buttons released this frame, computed by UpdateEdges()
+    uint32_t _mouseCancelledButtons{0};
+
+    /// @brief SDL event timestamp of each mouse button's most recent press, indexed by button - 1
+    uint64_t _mouseButtonPressTimestamps[32]{};
+
+    /// @brief Sensor and touchpad sample streams, per gamepad slot
+    GamepadStreams _gamepadStreams[PollingData::MAX_GAMEPADS];
+
+    /// @brief Keys pressed this frame, computed by UpdateEdges()
+    /// @note (current & ~previous) plus any key both pressed and released within the frame
+    KeyBitset _startedKeys;
+
+    /// @brief Keys released this frame, computed by UpdateEdges()
+    /// @note (previous & ~current) plus any key both pressed and released within the frame
+    KeyBitset _cancelledKeys;
+
     // Private Methods
+
+    /// @brief Records a key whose state changed in the current frame
+    /// @param scancode The SDL scancode that changed
+    /// @param keyboardSlot Keyboard slot whose bit also changed, or DeviceSlotMap::INVALID_SLOT
+    void JournalKey(const SDL_Scancode scancode, const int keyboardSlot);
+
+    /// @brief Checks if a keyboard slot is waiting for ShiftFrame() to free it
+    /// @param keyboardSlot Keyboard slot, or DeviceSlotMap::INVALID_SLOT
+    inline bool IsKeyboardSlotRemoved(const int keyboardSlot) const
+    {
+        return keyboardSlot >= 0 && (_removedKeyboardSlots & (uint32_t{1} << keyboardSlot)) != 0;
+    }
+
+    /// @brief Applies a press or release to a keyboard slot and the merged state
+    /// @param keyboardSlot Keyboard slot of the event, or DeviceSlotMap::INVALID_SLOT
+    /// @param scancode The SDL scancode that changed
+    /// @param isDown true for a press, false for a release
+    /// @param timestampNs SDL event timestamp in nanoseconds
+    void ApplyKey(const int keyboardSlot, const SDL_Scancode scancode, const bool isDown, const uint64_t timestampNs);
+
+    /// @brief Checks if any keyboard slot other than the given one holds a key
+    /// @param scancode The SDL scancode to check
+    /// @param exceptSlot Keyboard slot to ignore
+    /// @return true if another connected keyboard holds the key
+    bool IsKeyHeldElsewhere(const SDL_Scancode scancode, const int exceptSlot) const;
+
+    /// @brief Applies a press or release to a gamepad button in the current frame
+    /// @param gamepadSlot Gamepad slot of the event
+    /// @param button The SDL gamepad button that changed
+    /// @param isDown true for a press, false for a release
+    void ApplyGamepadButton(const int gamepadSlot, const SDL_GamepadButton button, const bool isDown);
+
+    /// @brief Tests a button bit in a per-gamepad mask array for one slot or any slot
+    /// @param masks Per-slot button masks
+    /// @param gamepadId SDL joystick instance id, or ANY_GAMEPAD
+    /// @param button The SDL gamepad button to test
+    /// @return true if the bit is set for the gamepad (or any gamepad)
+    bool TestGamepadMask(const uint32_t (&masks)[PollingData::MAX_GAMEPADS], const SDL_JoystickID gamepadId, const SDL_GamepadButton button) const;
+
+    /// @brief Resolves a gamepad id to the slot whose streams a query should read
+    /// @param gamepadId SDL joystick instance id, or ANY_GAMEPAD for the lowest connected slot
+    /// @return The slot, or DeviceSlotMap::INVALID_SLOT if no matching gamepad is connected
+    int GetGamepadStreamSlot(const SDL_JoystickID gamepadId) const;
+
+    /// @brief Clears the journal and per-key counters left over from the previous frame
+    /// @note Only touches keys that changed last frame unless the journal overflowed
+    void ResetStaleTransitions();
 };
 
 } // namespace velecs::input
@@ -0,0 +1,324 @@
+/// @file    KeyBitset.hpp
+/// @author  Matthew Green
+/// @date    2026-10-15 09:12:41
+///
+/// @section LICENSE
+///
+/// Copyright (c) 2026 Matthew Green - All rights reserved
+/// Unauthorized copying of this file, via any medium is strictly prohibited
+/// Proprietary and confidential
+
+#pragma once
+
+#include <SDL3/SDL_scancode.h>
+
+#include <bitset>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+
+#if defined(_MSC_VER)
+    #include <intrin.h>
+#endif
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #define VELECS_INPUT_SSE2 1
+    #include <emmintrin.h>
+#elif defined(__ARM_NEON) || defined(_M_ARM64)
+    #define VELECS_INPUT_NEON 1
+    #include <arm_neon.h>
+#endif
+
+namespace velecs::input {
+
+/// @struct KeyBitset
+/// @brief Fixed-size bitset holding one bit per SDL scancode
+///
+/// Replaces node-based containers for keyboard state so that membership tests are a
+/// single bit test and registering a key never allocates. The storage is a plain array
+/// of 64-bit words, which keeps the struct trivially copyable and lets whole-keyboard
+/// operations work a word at a time (or a vector register at a time where SSE2 or NEON
+/// is available).
+///
+/// @code
+/// KeyBitset keys;
+/// keys.Set(SDL_SCANCODE_SPACE);
+/// if (keys.Test(SDL_SCANCODE_SPACE)) { /* Space is down */ }
+///
+/// for (SDL_Scancode scancode : keys) { /* Visits only set bits, lowest scancode first */ }
+/// @endcode
+struct alignas(64) KeyBitset {
+public:
+    // Enums
+
+    // Public Fields
+
+    /// @brief Number of bits stored, one per SDL scancode
+    static constexpr std::size_t BIT_COUNT = SDL_SCANCODE_COUNT;
+
+    /// @brief Number of bits in a single storage word
+    static constexpr std::size_t WORD_BITS = 64;
+
+    /// @brief Number of storage words needed to hold BIT_COUNT bits
+    static constexpr std::size_t WORD_COUNT = (BIT_COUNT + WORD_BITS - 1) / WORD_BITS;
+
+    /// @brief Raw storage words, bit (scancode % 64) of word (scancode / 64) represents a scancode
+    uint64_t words[WORD_COUNT]{};
+
+    /// @class Iterator
+    /// @brief Forward iterator over the set bits of a KeyBitset, yielding scancodes
+    ///
+    /// Skips empty words entirely and finds each set bit with count-trailing-zeros,
+    /// so a walk costs O(words + set bits) rather than O(BIT_COUNT).
+    class Iterator {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = SDL_Scancode;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const SDL_Scancode*;
+        using reference = SDL_Scancode;
+
+        /// @brief Constructs an iterator positioned at the first set bit at or after a word
+        /// @param words Storage words of the bitset being walked
+        /// @param wordIndex Index of the word to start from (WORD_COUNT for end)
+        inline Iterator(const uint64_t* words, std::size_t wordIndex)
+            : _words(words), _wordIndex(wordIndex), _remaining(wordIndex < WORD_COUNT ? words[wordIndex] : 0)
+        {
+            SkipEmptyWords();
+        }
+
+        /// @brief Gets the scancode of the current set bit
+        inline SDL_Scancode operator*() const
+        {
+            return static_cast<SDL_Scancode>(_wordIndex * WORD_BITS + CountTrailingZeros(_remaining));
+        }
+
+        /// @brief Advances to the next set bit
+        inline Iterator& operator++()
+        {
+            _remaining &= _remaining - 1;
+            SkipEmptyWords();
+            return *this;
+        }
+
+        /// @brief Advances to the next set bit, returning the previous position
+        inline Iterator operator++(int)
+        {
+            Iterator copy = *this;
+            ++(*this);
+            return copy;
+        }
+
+        inline bool operator==(const Iterator& other) const
+        {
+            return _wordIndex == other._wordIndex && _remaining == other._remaining;
+        }
+
+        inline bool operator!=(const Iterator& other) const { return !(*this == other); }
+
+    private:
+        /// @brief Storage words of the bitset being walked
+        const uint64_t* _words;
+
+        /// @brief Index of the word currently being walked
+        std::size_t _wordIndex;
+
+        /// @brief Bits of the current word that have not been visited yet
+        uint64_t _remaining;
+
+        /// @brief Moves forward until a word with unvisited bits is found or the end is reached
+        inline void SkipEmptyWords()
+        {
+            while (_remaining == 0 && _wordIndex < WORD_COUNT)
+            {
+                if (++_wordIndex < WORD_COUNT) _remaining = _words[_wordIndex];
+            }
+        }
+    };
+
+    // Constructors and Destructors
+
+    /// @brief Default constructor - creates a bitset with no bits set
+    KeyBitset() = default;
+
+    // Public Methods
+
+    /// @brief Checks if the bit for a scancode is set
+    /// @param scancode The SDL scancode to test
+    /// @return true if the bit is set, false otherwise or if the scancode is out of range
+    inline bool Test(const SDL_Scancode scancode) const
+    {
+        const std::size_t index = static_cast<std::size_t>(scancode);
+        if (index >= BIT_COUNT) return false;
+        return (words[index / WORD_BITS] >> (index % WORD_BITS)) & 1u;
+    }
+
+    /// @brief Sets the bit for a scancode
+    /// @param scancode The SDL scancode to set
+    /// @note Out of range scancodes are ignored
+    inline void Set(const SDL_Scancode scancode)
+    {
+        const std::size_t index = static_cast<std::size_t>(scancode);
+        if (index >= BIT_COUNT) return;
+        words[index / WORD_BITS] |= uint64_t{1} << (index % WORD_BITS);
+    }
+
+    /// @brief Clears the bit for a scancode
+    /// @param scancode The SDL scancode to clear
+    /// @note Out of range scancodes are ignored
+    inline void Reset(const SDL_Scancode scancode)
+    {
+        const std::size_t index = static_cast<std::size_t>(scancode);
+        if (index >= BIT_COUNT) return;
+        words[index / WORD_BITS] &= ~(uint64_t{1} << (index % WORD_BITS));
+    }
+
+    /// @brief Sets or clears the bit for a scancode
+    /// @param scancode The SDL scancode to update
+    /// @param value true to set the bit, false to clear it
+    inline void Assign(const SDL_Scancode scancode, const bool value)
+    {
+        if (value) Set(scancode);
+        else Reset(scancode);
+    }
+
+    /// @brief Clears every bit in the set
+    inline void Clear()
+    {
+        for (std::size_t i = 0; i < WORD_COUNT; ++i) words[i] = 0;
+    }
+
+    /// @brief Sets every bit that is set in another bitset
+    /// @param other Bitset of scancodes to set
+    inline void SetAll(const KeyBitset& other)
+    {
+        for (std::size_t i = 0; i < WORD_COUNT; ++i) words[i] |= other.words[i];
+    }
+
+    /// @brief Checks if any scancode is set in both bitsets
+    /// @param other Bitset to compare against
+    /// @return true if the bitsets share at least one scancode, false otherwise
+    inline bool Intersects(const KeyBitset& other) const
+    {
+        uint64_t combined = 0;
+        for (std::size_t i = 0; i < WORD_COUNT; ++i) combined |= words[i] & other.words[i];
+        return combined != 0;
+    }
+
+    /// @brief Checks if any bit in the set is set
+    /// @return true if at least one scancode is set, false otherwise
+    inline bool Any() const
+    {
+        uint64_t combined = 0;
+        for (std::size_t i = 0; i < WORD_COUNT; ++i) combined |= words[i];
+        return combined != 0;
+    }
+
+    /// @brief Counts the number of set bits
+    /// @return Number of scancodes in the set
+    inline std::size_t Count() const
+    {
+        std::size_t count = 0;
+        for (std::size_t i = 0; i < WORD_COUNT; ++i) count += std::bitset<WORD_BITS>(words[i]).count();
+        return count;
+    }
+
+    /// @brief Gets an iterator to the lowest set scancode
+    inline Iterator begin() const { return Iterator(words, 0); }
+
+    /// @brief Gets the past-the-end iterator
+    inline Iterator end() const { return Iterator(words, WORD_COUNT); }
+
+    /// @brief Invokes a function for every set scancode, lowest first
+    /// @param func Callable taking an SDL_Scancode
+    template<typename Func>
+    inline void ForEach(Func&& func) const
+    {
+        for (std::size_t i = 0; i < WORD_COUNT; ++i)
+        {
+            uint64_t remaining = words[i];
+            while (remaining != 0)
+            {
+                func(static_cast<SDL_Scancode>(i * WORD_BITS + CountTrailingZeros(remaining)));
+                remaining &= remaining - 1;
+            }
+        }
+    }
+
+    /// @brief Gets the index of the lowest set bit of a non-zero word
+    /// @param word The word to scan, must not be zero
+    /// @return Number of trailing zero bits
+    static inline std::size_t CountTrailingZeros(const uint64_t word)
+    {
+#if defined(_MSC_VER)
+        unsigned long index = 0;
+        _BitScanForward64(&index, word);
+        return static_cast<std::size_t>(index);
+#else
+        return static_cast<std::size_t>(__builtin_ctzll(word));
+#endif
+    }
+
+    /// @brief Computes the press and release edges between two key states in a single pass
+    /// @param previous Key state at the end of the previous frame
+    /// @param current Key state at the end of the current frame
+    /// @param pressed Keys that received at least one press during the frame
+    /// @param released Keys that received at least one release during the frame
+    /// @param outStarted Receives (current & ~previous) | (pressed & released)
+    /// @param outCancelled Receives (previous & ~current) | (pressed & released)
+    /// @note Keys both pressed and released within one frame appear in both outputs, so
+    ///       sub-frame taps still report a started and a cancelled edge
+    static inline void ComputeEdges(
+        const KeyBitset& previous,
+        const KeyBitset& current,
+        const KeyBitset& pressed,
+        const KeyBitset& released,
+        KeyBitset& outStarted,
+        KeyBitset& outCancelled
+    )
+    {
+#if defined(VELECS_INPUT_SSE2)
+        for (std::size_t i = 0; i < WORD_COUNT; i += 2)
+        {
+            const __m128i prev = _mm_load_si128(reinterpret_cast<const __m128i*>(previous.words + i));
+            const __m128i curr = _mm_load_si128(reinterpret_cast<const __m128i*>(current.words + i));
+            const __m128i bounced = _mm_and_si128(
+                _mm_load_si128(reinterpret_cast<const __m128i*>(pressed.words + i)),
+                _mm_load_si128(reinterpret_cast<const __m128i*>(released.words + i))
+            );
+            _mm_store_si128(reinterpret_cast<__m128i*>(outStarted.words + i), _mm_or_si128(_mm_andnot_si128(prev, curr), bounced));
+            _mm_store_si128(reinterpret_cast<__m128i*>(outCancelled.words + i), _mm_or_si128(_mm_andnot_si128(curr, prev), bounced));
+        }
+#elif defined(VELECS_INPUT_NEON)
+        for (std::size_t i = 0; i < WORD_COUNT; i += 2)
+        {
+            const uint64x2_t prev = vld1q_u64(previous.words + i);
+            const uint64x2_t curr = vld1q_u64(current.words + i);
+            const uint64x2_t bounced = vandq_u64(vld1q_u64(pressed.words + i), vld1q_u64(released.words + i));
+            vst1q_u64(outStarted.words + i, vorrq_u64(vbicq_u64(curr, prev), bounced));
+            vst1q_u64(outCancelled.words + i, vorrq_u64(vbicq_u64(prev, curr), bounced));
+        }
+#else
+        for (std::size_t i = 0; i < WORD_COUNT; ++i)
+        {
+            const uint64_t bounced = pressed.words[i] & released.words[i];
+            outStarted.words[i] = (current.words[i] & ~previous.words[i]) | bounced;
+            outCancelled.words[i] = (previous.words[i] & ~current.words[i]) | bounced;
+        }
+#endif
+    }
+
+protected:
+    // Protected Fields
+
+    // Protected Methods
+
+private:
+    // Private Fields
+
+    // Private Methods
+};
+
+static_assert(KeyBitset::WORD_COUNT % 2 == 0, "KeyBitset vector paths process two words at a time");
+
+} // namespace velecs::input
@@ -0,0 +1,70 @@
+/// @file    NameKey.hpp
+/// @author  Matthew Green
+/// @date    2026-10-15 18:21:09
+///
+/// @section LICENSE
+///
+/// Copyright (c) 2026 Matthew Green - All rights reserved
+/// Unauthorized copying of this file, via any medium is strictly prohibited
+/// Proprietary and confidential
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+namespace velecs::input {
+
+/// @struct NameKey
+/// @brief 64-bit FNV-1a hash of a profile, map or action name
+///
+/// Looking a name up through NameUuidRegistry builds a std::string and hashes it on every
+/// call. A NameKey is hashed once, at compile time when constructed from a literal, and
+/// looked up in a flat sorted index without touching strings or allocating.
+///
+/// @code
+/// constexpr NameKey JUMP{"Jump"};
+/// Action* jump = nullptr;
+/// if (playerMap.TryGetAction(JUMP, jump)) { /* ... */ }
+/// @endcode
+///
+/// @note Adding a name whose key collides with an existing name throws, so a key always
+///       identifies a single name within its registry.
+struct NameKey {
+    /// @brief FNV-1a 64-bit offset basis
+    static constexpr uint64_t OFFSET_BASIS = 14695981039346656037ull;
+
+    /// @brief FNV-1a 64-bit prime
+    static constexpr uint64_t PRIME = 1099511628211ull;
+
+    /// @brief The hashed name
+    uint64_t value{OFFSET_BASIS};
+
+    /// @brief Default constructor - the key of an empty name
+    constexpr NameKey() = default;
+
+    /// @brief Constructs the key of a name
+    /// @param name The name to hash
+    constexpr explicit NameKey(const std::string_view name) : value(Hash(name)) {}
+
+    /// @brief Hashes a name with FNV-1a
+    /// @param name The name to hash
+    /// @return The 64-bit hash
+    static constexpr uint64_t Hash(const std::string_view name)
+    {
+        uint64_t hash = OFFSET_BASIS;
+        for (std::size_t i = 0; i < name.size(); ++i)
+        {
+            hash ^= static_cast<uint8_t>(name[i]);
+            hash *= PRIME;
+        }
+        return hash;
+    }
+
+    constexpr bool operator==(const NameKey& other) const { return value == other.value; }
+    constexpr bool operator!=(const NameKey& other) const { return value != other.value; }
+    constexpr bool operator<(const NameKey& other) const { return value < other.value; }
+};
+
+} // namespace velecs::input
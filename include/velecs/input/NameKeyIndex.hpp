@@ -0,0 +1,115 @@
+/// @file    NameKeyIndex.hpp
+/// @author  Matthew Green
+/// @date    2026-10-15 18:27:44
+///
+/// @section LICENSE
+///
+/// Copyright (c) 2026 Matthew Green - All rights reserved
+/// Unauthorized copying of this file, via any medium is strictly prohibited
+/// Proprietary and confidential
+
+#pragma once
+
+#include "velecs/input/NameKey.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace velecs::input {
+
+/// @class NameKeyIndex
+/// @brief Flat, sorted index from NameKey to the registry entry of that name
+///
+/// Kept alongside a NameUuidRegistry, which still owns the entries. Lookups are a binary
+/// search over a contiguous array of keys, so they never allocate or hash at runtime.
+///
+/// @tparam T Type of the indexed entries
+///
+/// @code
+/// NameKeyIndex<ActionMap> index;
+/// index.Add(name, map);
+/// ActionMap* found = nullptr;
+/// index.TryGet(NameKey{"Player"}, found);
+/// @endcode
+template<typename T>
+class NameKeyIndex {
+public:
+    // Enums
+
+    // Public Fields
+
+    // Constructors and Destructors
+
+    /// @brief Default constructor - creates an empty index
+    NameKeyIndex() = default;
+
+    // Public Methods
+
+    /// @brief Checks that a name can be indexed without colliding with another name
+    /// @param name Name about to be registered
+    /// @throws std::runtime_error if a different name in the index has the same key
+    /// @note Called before the entry is registered, so a collision leaves the registry untouched.
+    ///       A repeat of an indexed name is left for the registry to reject.
+    void CheckCollision(const std::string& name) const
+    {
+        const NameKey key{name};
+        const auto it = std::lower_bound(_entries.begin(), _entries.end(), key, CompareKey);
+        if (it != _entries.end() && it->key == key && it->entry->GetName() != name)
+        {
+            throw std::runtime_error("Name '" + name + "' has the same NameKey as '" + it->entry->GetName() + "'");
+        }
+    }
+
+    /// @brief Indexes an entry under the key of its name
+    /// @param name Name the entry was registered with
+    /// @param entry The entry, must outlive the index
+    /// @throws std::runtime_error if another name in the index has the same key
+    void Add(const std::string& name, T& entry)
+    {
+        const NameKey key{name};
+        const auto it = std::lower_bound(_entries.begin(), _entries.end(), key, CompareKey);
+        if (it != _entries.end() && it->key == key)
+        {
+            throw std::runtime_error("Name '" + name + "' has the same NameKey as an existing name");
+        }
+        _entries.insert(it, Entry{key, &entry});
+    }
+
+    /// @brief Attempts to find the entry with a key
+    /// @param key Key of the entry's name
+    /// @param outEntry Reference to store pointer to the entry if found
+    /// @return true if an entry was found, false otherwise
+    inline bool TryGet(const NameKey key, T*& outEntry) const
+    {
+        const auto it = std::lower_bound(_entries.begin(), _entries.end(), key, CompareKey);
+        if (it == _entries.end() || it->key != key) return false;
+        outEntry = it->entry;
+        return true;
+    }
+
+protected:
+    // Protected Fields
+
+    // Protected Methods
+
+private:
+    // Private Fields
+
+    /// @struct Entry
+    /// @brief One indexed name
+    struct Entry {
+        NameKey key;
+        T* entry;
+    };
+
+    /// @brief Entries sorted by key
+    std::vector<Entry> _entries;
+
+    // Private Methods
+
+    static inline bool CompareKey(const Entry& entry, const NameKey key) { return entry.key < key; }
+};
+
+} // namespace velecs::input
@@ -10,10 +10,15 @@
 
 #pragma once
 
+#include "velecs/input/KeyBitset.hpp"
+
 #include <SDL3/SDL_scancode.h>
 #include <SDL3/SDL_keycode.h>
+#include <SDL3/SDL_gamepad.h>
+#include <SDL3/SDL_mouse.h>
 
-#include <set>
+#include <cstddef>
+#include <type_traits>
 
 namespace velecs::input {
 
@@ -23,17 +28,35 @@ namespace velecs::input {
 /// This structure holds the complete state of all input devices at a specific point in time.
 /// It includes keyboard state and can be extended to include mouse, controller, and other
 /// input device states as needed.
+///
+/// Keyboard state is kept both merged across every keyboard (downKeys) and per connected
+/// keyboard in a dense array indexed by keyboard slot. Slots are assigned by
+/// InputPollingState, which maps SDL_KeyboardID values to slots in O(1).
+///
+/// Gamepad state uses the same slot scheme, laid out as struct-of-arrays: one button
+/// bitmask per pad and one fixed axis array per pad. The whole gamepad block is a few
+/// hundred bytes, so it is copied wholesale at frame shift.
+///
+/// Mouse state is merged across every mouse. Buttons and position persist between
+/// frames, while relative motion and wheel deltas are sums over the frame and start
+/// again from zero at every frame shift.
 struct PollingData {
 public:
     // Enums
 
     // Public Fields
 
-    /// @brief Set of currently pressed keyboard scancodes
+    /// @brief Maximum number of keyboards tracked individually
+    static constexpr std::size_t MAX_KEYBOARDS = 8;
+
+    /// @brief Pseudo-slot that refers to the merged state of every keyboard
+    static constexpr int ANY_KEYBOARD_SLOT = static_cast<int>(MAX_KEYBOARDS);
+
+    /// @brief Bitset of currently pressed keyboard scancodes
     /// @note Uses SDL_Scancode for hardware-independent key identification
     /// @note Updated via RegisterKey/UnregisterKey in response to SDL_KEYDOWN/SDL_KEYUP events
     /// @note Persists across frames until explicitly unregistered
-    std::set<SDL_Scancode> downKeys;
+    KeyBitset downKeys;
 
     /// @brief Current modifier key states from SDL
     /// @note Includes both physical modifier keys (Ctrl, Shift, Alt) and toggle states (Caps Lock, Num Lock)
@@ -41,9 +64,40 @@ public:
     /// @note Combines KMOD_* flags using bitwise OR operations
     SDL_Keymod keymods{SDL_KMOD_NONE};
 
+    /// @brief Currently pressed scancodes for each connected keyboard, indexed by keyboard slot
+    /// @note A scancode is set in downKeys while any keyboard slot holds it
+    KeyBitset keyboardKeys[MAX_KEYBOARDS];
+
+    /// @brief Maximum number of gamepads tracked simultaneously
+    static constexpr std::size_t MAX_GAMEPADS = 8;
+
+    /// @brief Pressed buttons for each connected gamepad, indexed by gamepad slot
+    /// @note Bit N is set while SDL_GamepadButton N is held
+    uint32_t gamepadButtons[MAX_GAMEPADS]{};
+
+    /// @brief Normalized axis values for each connected gamepad, indexed by gamepad slot then SDL_GamepadAxis
+    /// @note Sticks range from -1.0 to 1.0, triggers from 0.0 to 1.0
+    float gamepadAxes[MAX_GAMEPADS][SDL_GAMEPAD_AXIS_COUNT]{};
+
+    /// @brief Pressed mouse buttons across every mouse
+    /// @note Bit N-1 is set while SDL mouse button N is held, matching SDL_BUTTON_MASK()
+    uint32_t mouseButtons{0};
+
+    /// @brief Last reported cursor position in window coordinates
+    float mouseX{0.0f};
+    float mouseY{0.0f};
+
+    /// @brief Relative mouse motion summed over every motion event of the frame
+    /// @note Reset to zero at each frame shift
+    float mouseDeltaX{0.0f};
+    float mouseDeltaY{0.0f};
+
+    /// @brief Wheel scroll summed over every wheel event of the frame, positive is right/away from the user
+    /// @note Reset to zero at each frame shift
+    float mouseWheelX{0.0f};
+    float mouseWheelY{0.0f};
+
     // Future addition examples:
-    // Vec2 mousePos{Vec2::ZERO};
-    // float mouseWheel{0};
     // bool windowHasFocus{true};
 
     // Constructors and Destructors
@@ -75,7 +129,49 @@ public:
     /// @see IsKeyUp(), RegisterKey(), UnregisterKey()
     inline bool IsKeyDown(const SDL_Scancode scancode) const
     { 
-        return downKeys.find(scancode) != downKeys.end();
+        return downKeys.Test(scancode);
+    }
+
+    /// @brief Gets the pressed keys for a keyboard slot
+    /// @param keyboardSlot Slot index, or ANY_KEYBOARD_SLOT for the merged state of all keyboards
+    /// @return The slot's key bitset, or an empty bitset for an invalid slot
+    inline const KeyBitset& GetKeyboardKeys(const int keyboardSlot) const
+    {
+        static const KeyBitset EMPTY{};
+        if (keyboardSlot == ANY_KEYBOARD_SLOT) return downKeys;
+        if (keyboardSlot < 0 || keyboardSlot >= ANY_KEYBOARD_SLOT) return EMPTY;
+        return keyboardKeys[keyboardSlot];
+    }
+
+    /// @brief Checks if a gamepad button is held on a gamepad slot
+    /// @param gamepadSlot Slot index in [0, MAX_GAMEPADS)
+    /// @param button The SDL gamepad button to check
+    /// @return true if the button is held, false otherwise or if the slot or button is invalid
+    inline bool IsGamepadButtonDown(const int gamepadSlot, const SDL_GamepadButton button) const
+    {
+        if (gamepadSlot < 0 || static_cast<std::size_t>(gamepadSlot) >= MAX_GAMEPADS) return false;
+        if (button < 0 || button >= SDL_GAMEPAD_BUTTON_COUNT) return false;
+        return (gamepadButtons[gamepadSlot] >> button) & 1u;
+    }
+
+    /// @brief Gets an axis value on a gamepad slot
+    /// @param gamepadSlot Slot index in [0, MAX_GAMEPADS)
+    /// @param axis The SDL gamepad axis to read
+    /// @return The normalized axis value, or 0.0 if the slot or axis is invalid
+    inline float GetGamepadAxis(const int gamepadSlot, const SDL_GamepadAxis axis) const
+    {
+        if (gamepadSlot < 0 || static_cast<std::size_t>(gamepadSlot) >= MAX_GAMEPADS) return 0.0f;
+        if (axis < 0 || axis >= SDL_GAMEPAD_AXIS_COUNT) return 0.0f;
+        return gamepadAxes[gamepadSlot][axis];
+    }
+
+    /// @brief Checks if a mouse button is held
+    /// @param button SDL mouse button index (SDL_BUTTON_LEFT, SDL_BUTTON_RIGHT, ...)
+    /// @return true if the button is held, false otherwise or if the button is out of range
+    inline bool IsMouseButtonDown(const uint8_t button) const
+    {
+        if (button == 0 || button > 32) return false;
+        return (mouseButtons & SDL_BUTTON_MASK(button)) != 0;
     }
 
     /// @brief Checks if a specific key scancode is not currently pressed
@@ -85,7 +181,7 @@ public:
     /// @see IsKeyDown(), RegisterKey(), UnregisterKey()
     inline bool IsKeyUp(const SDL_Scancode scancode) const
     {
-        return downKeys.find(scancode) == downKeys.end(); 
+        return !downKeys.Test(scancode);
     }
 
     /// @brief Registers a key as currently pressed
@@ -96,8 +192,8 @@ public:
     /// @see UnregisterKey(), IsKeyDown()
     inline void RegisterKey(const SDL_Scancode scancode)
     {
-        // Add key to current frame's pressed keys set
-        downKeys.emplace(scancode);
+        // Set key bit in current frame's pressed keys
+        downKeys.Set(scancode);
     }
 
     /// @brief Unregisters a key as no longer pressed
@@ -107,8 +203,8 @@ public:
     /// @see RegisterKey(), IsKeyUp()
     inline void UnregisterKey(const SDL_Scancode scancode)
     {
-        // Remove key from current frame's pressed keys set
-        downKeys.erase(scancode);
+        // Clear key bit in current frame's pressed keys
+        downKeys.Reset(scancode);
     }
 
     /// @brief Checks if any modifier keys are currently active
@@ -161,4 +257,7 @@ private:
     // Private Methods
 };
 
+static_assert(SDL_GAMEPAD_BUTTON_COUNT <= 32, "PollingData::gamepadButtons stores one bit per SDL_GamepadButton");
+static_assert(std::is_trivially_copyable_v<PollingData>, "PollingData must stay trivially copyable so frame shifts are plain memory copies");
+
 } // namespace velecs::input
@@ -0,0 +1,171 @@
+/// @file    ProfileCompiler.hpp
+/// @author  Matthew Green
+/// @date    2026-10-15 19:31:05
+///
+/// @section LICENSE
+///
+/// Copyright (c) 2026 Matthew Green - All rights reserved
+/// Unauthorized copying of this file, via any medium is strictly prohibited
+/// Proprietary and confidential
+
+#pragma once
+
+#include "velecs/input/ProfileFormat.hpp"
+#include "velecs/input/ActionMap.hpp"
+#include "velecs/input/Action.hpp"
+
+#include <velecs/common/NameUuidRegistry.hpp>
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace velecs::input {
+
+class ActionProfile;
+
+using ActionProfileRegistry = velecs::common::NameUuidRegistry<ActionProfile>;
+
+/// @class ProfileCompiler
+/// @brief Produces precompiled profile files (see ProfileFormat)
+///
+/// Profiles are authored in a small line-based text format and compiled offline, or
+/// serialized from profiles built in code. Either way the result loads with
+/// ProfileImage::MapFile() and Input::LoadProfiles() without running any configurators.
+///
+/// The text format has one declaration per line. Each declaration belongs to the
+/// nearest preceding declaration of the enclosing kind, so indentation is only for
+/// readability. Names containing spaces are quoted, and `#` starts a comment.
+///
+///     profile DefaultProfile
+///         map Player
+///             action Jump
+///                 button "PC Jump" Space
+///             action Move trigger=changed
+///                 vec2 "WASD Move" D A W S deadzone=0.1
+///                 vec2 "Arrow Keys Move" Right Left Up Down deadzone=0.1
+///             action Fire
+///                 mousebutton "LMB" left
+///             action Look
+///                 mousedelta "Mouse Look" sensitivity=0.5 inverty
+///         map UI priority=1 consume=keys enabled=false
+///
+/// Options:
+/// - profile, map, action: `enabled=true|false`
+/// - map: `priority=<int>`, `consume=none|keys|all`
+/// - action: `trigger=continuous|changed`
+/// - button, vec2: `keyboard=<id>`, scancodes by SDL scancode name
+///   (SDL assigns keyboard ids per session, so a `keyboard` id only holds for the session
+///   that wrote the profile; omit it to read any keyboard)
+/// - vec2: `deadzone=<float>`
+/// - mousebutton: `left|middle|right|x1|x2` or an SDL button index
+/// - mousedelta: `sensitivity=<float>`, `inverty`
+///
+/// @code
+/// std::vector<uint8_t> bytes = ProfileCompiler::CompileText(source);
+/// ProfileCompiler::WriteFile("profiles.vipf", bytes);
+/// @endcode
+class ProfileCompiler {
+public:
+    // Enums
+
+    // Public Fields
+
+    // Constructors and Destructors
+
+    /// @brief Default constructor - creates an empty file
+    ProfileCompiler() = default;
+
+    // Public Methods
+
+    /// @brief Starts a new profile, later maps are added to it
+    void AddProfile(const std::string_view name, const bool enabled = true);
+
+    /// @brief Starts a new map in the current profile, later actions are added to it
+    /// @throws std::runtime_error if no profile has been added
+    void AddMap(const std::string_view name, const int32_t priority = 0,
+        const ActionMap::InputConsumption consumption = ActionMap::InputConsumption::None, const bool enabled = true);
+
+    /// @brief Starts a new action in the current map, later bindings are added to it
+    /// @throws std::runtime_error if no map has been added
+    void AddAction(const std::string_view name,
+        const Action::TriggerMode triggerMode = Action::TriggerMode::Continuous, const bool enabled = true);
+
+    /// @brief Adds a binding to the current action
+    /// @throws std::runtime_error if no action has been added
+    void AddBinding(const std::string_view name, const ButtonBinding::Data& data);
+    void AddBinding(const std::string_view name, const Vec2Binding::Data& data);
+    void AddBinding(const std::string_view name, const MouseButtonBinding::Data& data);
+    void AddBinding(const std::string_view name, const MouseDeltaBinding::Data& data);
+
+    /// @brief Adds a described binding to the current action
+    /// @param name Name of the binding
+    /// @param record Kind and payload, as filled in by Describe()
+    /// @throws std::runtime_error if no action has been added
+    void AddBinding(const std::string_view name, const ProfileFormat::BindingRecord& record);
+
+    /// @brief Lays out everything added so far as a profile file
+    /// @return The file's bytes, loadable with ProfileImage
+    std::vector<uint8_t> Finish() const;
+
+    /// @brief Compiles the text authoring format
+    /// @param source Text in the format described above
+    /// @return The file's bytes
+    /// @throws std::runtime_error naming the line of the first error
+    static std::vector<uint8_t> CompileText(const std::string_view source);
+
+    /// @brief Serializes profiles built in code
+    /// @param profiles The profiles to serialize, in processing order
+    /// @return The file's bytes
+    /// @throws std::runtime_error if a binding is not of a built-in type
+    static std::vector<uint8_t> Serialize(ActionProfileRegistry& profiles);
+
+    /// @brief Describes a live binding as a binding record
+    /// @param binding The binding to describe
+    /// @param outRecord Receives the kind and payload, the name is left empty
+    /// @return true if the binding is of a built-in type, false if it has no binary form
+    static bool Describe(const InputBinding& binding, ProfileFormat::BindingRecord& outRecord);
+
+    /// @brief Writes a compiled file to disk
+    /// @param path Destination path, overwritten if it exists
+    /// @param bytes Output of Finish(), CompileText() or Serialize()
+    /// @throws std::runtime_error if the file cannot be written
+    static void WriteFile(const std::string& path, const std::vector<uint8_t>& bytes);
+
+protected:
+    // Protected Fields
+
+    // Protected Methods
+
+private:
+    // Private Fields
+
+    std::vector<ProfileFormat::ProfileRecord> _profiles;
+    std::vector<ProfileFormat::MapRecord> _maps;
+    std::vector<ProfileFormat::ActionRecord> _actions;
+    std::vector<ProfileFormat::BindingRecord> _bindings;
+
+    /// @brief Every name, back to back
+    std::string _strings;
+
+    // Private Methods
+
+    /// @brief Appends a name to the string pool
+    ProfileFormat::StringRef AddString(const std::string_view name);
+
+    /// @brief Appends a binding record to the current action
+    /// @return The new record, with its name and kind set
+    ProfileFormat::BindingRecord& AddBindingRecord(const std::string_view name, const ProfileFormat::BindingKind kind);
+
+    /// @brief Compiles one line of the text format
+    /// @param tokens The line split into words, quotes removed
+    void CompileLine(const std::vector<std::string>& tokens);
+
+    /// @brief Splits a line of the text format into words
+    /// @param line The line, without its newline
+    /// @return The words, empty for blank and comment-only lines
+    static std::vector<std::string> Tokenize(const std::string_view line);
+};
+
+} // namespace velecs::input
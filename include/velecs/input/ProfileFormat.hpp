@@ -0,0 +1,168 @@
+/// @file    ProfileFormat.hpp
+/// @author  Matthew Green
+/// @date    2026-10-15 18:58:13
+///
+/// @section LICENSE
+///
+/// Copyright (c) 2026 Matthew Green - All rights reserved
+/// Unauthorized copying of this file, via any medium is strictly prohibited
+/// Proprietary and confidential
+
+#pragma once
+
+#include "velecs/input/InputBindings/ButtonBinding.hpp"
+#include "velecs/input/InputBindings/Vec2Binding.hpp"
+#include "velecs/input/InputBindings/MouseButtonBinding.hpp"
+#include "velecs/input/InputBindings/MouseDeltaBinding.hpp"
+
+#include <cstdint>
+#include <type_traits>
+
+namespace velecs::input {
+
+/// @struct ProfileFormat
+/// @brief On-disk layout of a precompiled binding profile file
+///
+/// A profile file is a header followed by four flat record arrays and a string pool:
+///
+///     Header
+///     ProfileRecord[profileCount]
+///     MapRecord[mapCount]
+///     ActionRecord[actionCount]
+///     BindingRecord[bindingCount]
+///     char strings[stringBytes]
+///
+/// Every record is a fixed-size, 4-byte aligned POD, so a mapped file is read in place
+/// without parsing. Children are referenced by index ranges into the next array, names
+/// by offset and length into the string pool. Binding payloads are the binding types'
+/// own Data structs, so they are handed to the bindings as-is.
+///
+/// Files are written in native byte order. A file from a machine of the other byte
+/// order fails the magic check rather than loading garbage.
+///
+/// @see ProfileCompiler to produce files, ProfileImage to map and validate them
+struct ProfileFormat {
+    // Enums
+
+    /// @enum BindingKind
+    /// @brief Which member of BindingRecord::data is in use
+    enum class BindingKind : uint8_t {
+        Button,
+        Vec2,
+        MouseButton,
+        MouseDelta,
+    };
+
+    // Public Fields
+
+    /// @brief "VIPF" read as a native uint32_t
+    static constexpr uint32_t MAGIC = 0x46504956u;
+
+    /// @brief Incremented on any change to the layout below
+    static constexpr uint16_t VERSION = 1;
+
+    /// @struct StringRef
+    /// @brief A name in the string pool, not null terminated
+    struct StringRef {
+        uint32_t offset;
+        uint32_t length;
+    };
+
+    /// @struct Header
+    /// @brief First bytes of every file
+    struct Header {
+        uint32_t magic;
+        uint16_t version;
+        uint16_t headerSize;
+        uint32_t profileCount;
+        uint32_t mapCount;
+        uint32_t actionCount;
+        uint32_t bindingCount;
+        uint32_t stringBytes;
+        uint32_t reserved;
+    };
+
+    /// @struct ProfileRecord
+    /// @brief One ActionProfile, owning maps [firstMap, firstMap + mapCount)
+    struct ProfileRecord {
+        StringRef name;
+        uint32_t firstMap;
+        uint32_t mapCount;
+        uint8_t enabled;
+        uint8_t padding[3];
+    };
+
+    /// @struct MapRecord
+    /// @brief One ActionMap, owning actions [firstAction, firstAction + actionCount)
+    struct MapRecord {
+        StringRef name;
+        uint32_t firstAction;
+        uint32_t actionCount;
+        int32_t priority;
+        uint8_t inputConsumption; ///< ActionMap::InputConsumption
+        uint8_t enabled;
+        uint8_t padding[2];
+    };
+
+    /// @struct ActionRecord
+    /// @brief One Action, owning bindings [firstBinding, firstBinding + bindingCount)
+    struct ActionRecord {
+        StringRef name;
+        uint32_t firstBinding;
+        uint32_t bindingCount;
+        uint8_t triggerMode; ///< Action::TriggerMode
+        uint8_t enabled;
+        uint8_t padding[2];
+    };
+
+    /// @struct BindingRecord
+    /// @brief One binding of a built-in type
+    struct BindingRecord {
+        StringRef name;
+        BindingKind kind;
+        uint8_t padding[3];
+        union {
+            ButtonBinding::Data button;
+            Vec2Binding::Data vec2;
+            MouseButtonBinding::Data mouseButton;
+            MouseDeltaBinding::Data mouseDelta;
+        } data;
+    };
+
+    /// @brief Checks if two binding records have the same kind and payload, ignoring names
+    /// @param a First record
+    /// @param b Second record
+    /// @return true if both would construct identical bindings
+    static inline bool IsSameBinding(const BindingRecord& a, const BindingRecord& b)
+    {
+        if (a.kind != b.kind) return false;
+        switch (a.kind)
+        {
+            case BindingKind::Button:
+                return a.data.button.scancode == b.data.button.scancode
+                    && a.data.button.keyboardId == b.data.button.keyboardId;
+            case BindingKind::Vec2:
+                return a.data.vec2.posXScancode == b.data.vec2.posXScancode
+                    && a.data.vec2.negXScancode == b.data.vec2.negXScancode
+                    && a.data.vec2.posYScancode == b.data.vec2.posYScancode
+                    && a.data.vec2.negYScancode == b.data.vec2.negYScancode
+                    && a.data.vec2.deadzone == b.data.vec2.deadzone
+                    && a.data.vec2.keyboardId == b.data.vec2.keyboardId;
+            case BindingKind::MouseButton:
+                return a.data.mouseButton.button == b.data.mouseButton.button;
+            case BindingKind::MouseDelta:
+                return a.data.mouseDelta.sensitivity == b.data.mouseDelta.sensitivity
+                    && a.data.mouseDelta.invertY == b.data.mouseDelta.invertY;
+        }
+        return false;
+    }
+
+    static_assert(sizeof(Header) % 4 == 0, "Records must stay 4-byte aligned after the header");
+    static_assert(sizeof(ProfileRecord) % 4 == 0, "Records must stay 4-byte aligned");
+    static_assert(sizeof(MapRecord) % 4 == 0, "Records must stay 4-byte aligned");
+    static_assert(sizeof(ActionRecord) % 4 == 0, "Records must stay 4-byte aligned");
+    static_assert(sizeof(BindingRecord) % 4 == 0, "Records must stay 4-byte aligned");
+    static_assert(std::is_trivially_copyable<BindingRecord>::value, "Binding payloads are read in place");
+};
+
+} // namespace velecs::input
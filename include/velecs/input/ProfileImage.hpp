@@ -0,0 +1,141 @@
+/// @file    ProfileImage.hpp
+/// @author  Matthew Green
+/// @date    2026-10-15 19:06:40
+///
+/// @section LICENSE
+///
+/// Copyright (c) 2026 Matthew Green - All rights reserved
+/// Unauthorized copying of this file, via any medium is strictly prohibited
+/// Proprietary and confidential
+
+#pragma once
+
+#include "velecs/input/ProfileFormat.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace velecs::input {
+
+/// @class ProfileImage
+/// @brief A validated, read-only view of a precompiled profile file
+///
+/// MapFile() memory-maps the file, so only the pages actually read are loaded and
+/// nothing is parsed or copied. The whole image is validated once on construction
+/// (header, record ranges, string references and binding kinds), after which every
+/// accessor is a plain pointer read. An image can also own an in-memory buffer, such
+/// as the output of ProfileCompiler.
+///
+/// @code
+/// ProfileImage image = ProfileImage::MapFile("profiles.vipf");
+/// Input::LoadProfiles(image);
+/// @endcode
+class ProfileImage {
+public:
+    // Enums
+
+    // Public Fields
+
+    using Header = ProfileFormat::Header;
+    using ProfileRecord = ProfileFormat::ProfileRecord;
+    using MapRecord = ProfileFormat::MapRecord;
+    using ActionRecord = ProfileFormat::ActionRecord;
+    using BindingRecord = ProfileFormat::BindingRecord;
+
+    // Constructors and Destructors
+
+    /// @brief Constructs an image that owns a compiled buffer
+    /// @param bytes Output of ProfileCompiler
+    /// @throws std::runtime_error if the buffer is not a valid profile file
+    explicit ProfileImage(std::vector<uint8_t> bytes);
+
+    /// @brief Move constructor - the moved-from image becomes empty
+    ProfileImage(ProfileImage&& other) noexcept;
+
+    /// @brief Move assignment - the moved-from image becomes empty
+    ProfileImage& operator=(ProfileImage&& other) noexcept;
+
+    /// @brief Copy constructor is deleted, an image may own a mapping
+    ProfileImage(const ProfileImage&) = delete;
+
+    /// @brief Copy assignment is deleted, an image may own a mapping
+    ProfileImage& operator=(const ProfileImage&) = delete;
+
+    /// @brief Destructor - unmaps the file if the image was mapped
+    ~ProfileImage();
+
+    // Public Methods
+
+    /// @brief Memory-maps and validates a profile file
+    /// @param path Path of the file to map
+    /// @return The mapped image
+    /// @throws std::runtime_error if the file cannot be mapped or is not a valid profile file
+    static ProfileImage MapFile(const std::string& path);
+
+    /// @brief Gets the file header
+    inline const Header& GetHeader() const { return *reinterpret_cast<const Header*>(_data); }
+
+    inline const ProfileRecord* GetProfiles() const { return _profiles; }
+    inline const MapRecord* GetMaps() const { return _maps; }
+    inline const ActionRecord* GetActions() const { return _actions; }
+    inline const BindingRecord* GetBindings() const { return _bindings; }
+
+    inline uint32_t GetProfileCount() const { return GetHeader().profileCount; }
+    inline uint32_t GetMapCount() const { return GetHeader().mapCount; }
+    inline uint32_t GetActionCount() const { return GetHeader().actionCount; }
+    inline uint32_t GetBindingCount() const { return GetHeader().bindingCount; }
+
+    /// @brief Gets a name from the string pool
+    /// @param ref Reference taken from one of the image's records
+    /// @return View into the image, valid for the image's lifetime
+    inline std::string_view GetString(const ProfileFormat::StringRef ref) const
+    {
+        return std::string_view(_strings + ref.offset, ref.length);
+    }
+
+    /// @brief Gets the size of the image in bytes
+    inline std::size_t GetSize() const { return _size; }
+
+protected:
+    // Protected Fields
+
+    // Protected Methods
+
+private:
+    // Private Fields
+
+    /// @brief Start of the image, in _buffer or in the mapping
+    const uint8_t* _data{nullptr};
+
+    /// @brief Size of the image in bytes
+    std::size_t _size{0};
+
+    /// @brief Owned bytes when the image was not mapped
+    std::vector<uint8_t> _buffer;
+
+    /// @brief Whether _data is a file mapping that must be unmapped
+    bool _isMapped{false};
+
+    const ProfileRecord* _profiles{nullptr};
+    const MapRecord* _maps{nullptr};
+    const ActionRecord* _actions{nullptr};
+    const BindingRecord* _bindings{nullptr};
+    const char* _strings{nullptr};
+
+    // Private Methods
+
+    /// @brief Default constructor - creates an empty image, used by MapFile()
+    ProfileImage() = default;
+
+    /// @brief Validates the image at _data and sets the record pointers
+    /// @throws std::runtime_error if any header field, range or reference is invalid
+    void Validate();
+
+    /// @brief Releases the mapping, if any, and empties the image
+    void Reset();
+};
+
+} // namespace velecs::input
@@ -0,0 +1,167 @@
+/// @file    ProfileWatcher.hpp
+/// @author  Matthew Green
+/// @date    2026-10-15 20:12:48
+///
+/// @section LICENSE
+///
+/// Copyright (c) 2026 Matthew Green - All rights reserved
+/// Unauthorized copying of this file, via any medium is strictly prohibited
+/// Proprietary and confidential
+
+#pragma once
+
+#include "velecs/input/ProfileImage.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+
+namespace velecs::input {
+
+/// @class ProfileWatcher
+/// @brief Watches a profile file and recompiles it on a background thread when it changes
+///
+/// The file may be in the text authoring format or a precompiled profile file (see
+/// ProfileCompiler); precompiled files are recognised by their magic. On Linux changes
+/// are reported by inotify on the file's directory, so editors that save by replacing the
+/// file are seen too. Elsewhere, or if inotify is unavailable, the file's write time and
+/// size are polled.
+///
+/// Compilation happens entirely on the watcher's thread. A successful compile is parked
+/// as a pending ProfileImage, and the main thread takes it with TryTakeImage(), which
+/// never waits on compilation. A failed compile leaves the last good profiles in place
+/// and is reported through GetLastError().
+///
+/// @code
+/// ProfileWatcher watcher("bindings.txt");
+/// // Each frame, before evaluation:
+/// std::unique_ptr<ProfileImage> image;
+/// if (watcher.TryTakeImage(image)) Input::LoadProfiles(*image);
+/// @endcode
+class ProfileWatcher {
+public:
+    // Enums
+
+    // Public Fields
+
+    /// @brief How often the polling fallback checks the file
+    static constexpr std::chrono::milliseconds DEFAULT_POLL_INTERVAL{250};
+
+    /// @brief How long the file must stay quiet before it is recompiled, so a save
+    ///        written in several steps compiles once
+    static constexpr std::chrono::milliseconds SETTLE_DELAY{50};
+
+    // Constructors and Destructors
+
+    /// @brief Starts watching a file
+    /// @param path The profile file to watch
+    /// @param pollInterval How often to check the file when inotify is unavailable
+    /// @note The file is not compiled until it changes, load it once with Compile() first
+    explicit ProfileWatcher(const std::string& path, const std::chrono::milliseconds pollInterval = DEFAULT_POLL_INTERVAL);
+
+    /// @brief Copy constructor is deleted, the watcher owns a thread
+    ProfileWatcher(const ProfileWatcher&) = delete;
+
+    /// @brief Copy assignment is deleted, the watcher owns a thread
+    ProfileWatcher& operator=(const ProfileWatcher&) = delete;
+
+    /// @brief Destructor - stops and joins the watcher thread
+    ~ProfileWatcher();
+
+    // Public Methods
+
+    /// @brief Takes the most recently compiled image, if a change is waiting
+    /// @param outImage Receives the image when one is pending
+    /// @return true if an image was taken, false if nothing changed since the last take
+    /// @note Safe to call every frame, it only locks when an image is waiting
+    bool TryTakeImage(std::unique_ptr<ProfileImage>& outImage);
+
+    /// @brief Gets the error of the most recent failed compile
+    /// @return The error message, empty if the last compile succeeded
+    std::string GetLastError() const;
+
+    /// @brief Records an error from applying a taken image
+    /// @param error The error message, returned by GetLastError() until the next successful compile
+    /// @note Used by Input::Update() when a compiled image fails to load
+    void ReportError(const std::string& error);
+
+    /// @brief Gets the number of successful compiles since the watcher started
+    inline uint32_t GetReloadCount() const { return _reloadCount.load(std::memory_order_relaxed); }
+
+    /// @brief Gets the watched path
+    inline const std::string& GetPath() const { return _path; }
+
+    /// @brief Reads and compiles a profile file
+    /// @param path The file, in the text authoring format or precompiled
+    /// @return The compiled image
+    /// @throws std::runtime_error if the file cannot be read or does not compile
+    static ProfileImage Compile(const std::string& path);
+
+protected:
+    // Protected Fields
+
+    // Protected Methods
+
+private:
+    // Private Fields
+
+    /// @brief The watched file
+    const std::string _path;
+
+    /// @brief Interval of the polling fallback
+    const std::chrono::milliseconds _pollInterval;
+
+    /// @brief Cleared by the destructor to stop the thread
+    std::atomic<bool> _isRunning{true};
+
+    /// @brief Set while an image is waiting, lets TryTakeImage() skip the lock
+    std::atomic<bool> _hasPending{false};
+
+    /// @brief Successful compiles since the watcher started, see GetReloadCount()
+    std::atomic<uint32_t> _reloadCount{0};
+
+    /// @brief Guards _pending and _lastError
+    mutable std::mutex _mutex;
+
+    /// @brief Wakes the polling fallback early when stopping
+    std::condition_variable _stopSignal;
+
+    /// @brief Latest compiled image, not yet taken
+    std::unique_ptr<ProfileImage> _pending;
+
+    /// @brief Message of the most recent failed compile or load, cleared by a successful compile
+    std::string _lastError;
+
+#ifdef __linux__
+    /// @brief inotify instance, -1 when using the polling fallback
+    int _inotifyFd{-1};
+
+    /// @brief Pipe written by the destructor to wake the inotify wait, [read, write]
+    int _wakePipe[2]{-1, -1};
+#endif
+
+    /// @brief Declared last so every field is ready before the thread starts
+    std::thread _thread;
+
+    // Private Methods
+
+    /// @brief Thread body, waits for changes and recompiles
+    void Run();
+
+    /// @brief Compiles the file and publishes the result or the error
+    void Reload();
+
+    /// @brief Waits for changes with inotify until stopped
+    /// @return false if inotify failed and the caller should fall back to polling
+    bool WatchWithNotifications();
+
+    /// @brief Waits for changes by polling the file until stopped
+    void WatchWithPolling();
+};
+
+} // namespace velecs::input
@@ -0,0 +1,163 @@
+/// @file    SampleRing.hpp
+/// @author  Matthew Green
+/// @date    2026-10-15 13:40:52
+///
+/// @section LICENSE
+///
+/// Copyright (c) 2026 Matthew Green - All rights reserved
+/// Unauthorized copying of this file, via any medium is strictly prohibited
+/// Proprietary and confidential
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace velecs::input {
+
+/// @struct SampleSpan
+/// @brief Non-owning view over a contiguous run of samples
+///
+/// Minimal stand-in for std::span, which is not available in C++17.
+///
+/// @tparam T Sample type
+template<typename T>
+struct SampleSpan {
+public:
+    // Public Fields
+
+    /// @brief Pointer to the first sample, may be null when size is 0
+    const T* data{nullptr};
+
+    /// @brief Number of samples in the view
+    std::size_t size{0};
+
+    // Public Methods
+
+    inline const T* begin() const { return data; }
+    inline const T* end() const { return data + size; }
+    inline const T& operator[](const std::size_t index) const { return data[index]; }
+    inline bool IsEmpty() const { return size == 0; }
+};
+
+/// @class SampleRing
+/// @brief Fixed-capacity single-producer/single-consumer ring buffer for high-rate samples
+///
+/// Built for device streams (gyro, accelerometer, touchpad) that arrive faster than
+/// the frame rate. Every sample is kept rather than collapsed to the latest value. The
+/// producer pushes without locks. Once per frame the consumer latches the range of
+/// samples that arrived since the previous latch and reads it as a single contiguous
+/// SampleSpan.
+///
+/// Storage is mirrored: each sample is written both at (index % Capacity) and at
+/// (index % Capacity + Capacity). Any window of at most Capacity samples is then
+/// contiguous in memory, so readers get a zero-copy span even when the window wraps.
+///
+/// @tparam T Trivially copyable sample type
+/// @tparam Capacity Maximum number of samples retained between latches
+///
+/// @note If more than Capacity samples arrive between latches, the oldest are dropped.
+/// @note A latched span stays valid until the producer pushes Capacity - span.size more samples.
+template<typename T, std::size_t Capacity>
+class SampleRing {
+    static_assert(Capacity > 0, "SampleRing needs room for at least one sample");
+
+public:
+    // Enums
+
+    // Public Fields
+
+    /// @brief Maximum number of samples retained between latches
+    static constexpr std::size_t CAPACITY = Capacity;
+
+    // Constructors and Destructors
+
+    /// @brief Default constructor - creates an empty ring
+    SampleRing() = default;
+
+    /// @brief Copy constructor is deleted, rings are owned in place by their device
+    SampleRing(const SampleRing&) = delete;
+
+    /// @brief Copy assignment is deleted, rings are owned in place by their device
+    SampleRing& operator=(const SampleRing&) = delete;
+
+    // Public Methods
+
+    /// @brief Appends a sample (producer side)
+    /// @param sample The sample to store
+    /// @note Lock-free and allocation-free
+    inline void Push(const T& sample)
+    {
+        const uint64_t index = _writeCount.load(std::memory_order_relaxed);
+        const std::size_t slot = static_cast<std::size_t>(index % Capacity);
+        _storage[slot] = sample;
+        _storage[slot + Capacity] = sample;
+        _writeCount.store(index + 1, std::memory_order_release);
+    }
+
+    /// @brief Captures every sample pushed since the previous latch (consumer side)
+    /// @note Call once per frame, the result is read with GetFrameSamples()
+    inline void Latch()
+    {
+        const uint64_t end = _writeCount.load(std::memory_order_acquire);
+        uint64_t begin = _frameEnd;
+        if (end - begin > Capacity) begin = end - Capacity;
+
+        _frameBegin = begin;
+        _frameEnd = end;
+    }
+
+    /// @brief Gets the samples captured by the most recent Latch()
+    /// @return Contiguous view of the samples, oldest first
+    inline SampleSpan<T> GetFrameSamples() const
+    {
+        const std::size_t count = static_cast<std::size_t>(_frameEnd - _frameBegin);
+        if (count == 0) return {};
+        return SampleSpan<T>{&_storage[static_cast<std::size_t>(_frameBegin % Capacity)], count};
+    }
+
+    /// @brief Gets the most recently pushed sample
+    /// @param outSample Receives the sample if one exists
+    /// @return true if at least one sample has been pushed since the last Reset()
+    inline bool TryGetLatest(T& outSample) const
+    {
+        const uint64_t end = _writeCount.load(std::memory_order_acquire);
+        if (end == 0) return false;
+        outSample = _storage[static_cast<std::size_t>((end - 1) % Capacity)];
+        return true;
+    }
+
+    /// @brief Discards every sample
+    /// @note Not safe to call while the producer is pushing
+    inline void Reset()
+    {
+        _writeCount.store(0, std::memory_order_relaxed);
+        _frameBegin = 0;
+        _frameEnd = 0;
+    }
+
+protected:
+    // Protected Fields
+
+    // Protected Methods
+
+private:
+    // Private Fields
+
+    /// @brief Mirrored sample storage, see class description
+    T _storage[Capacity * 2]{};
+
+    /// @brief Total number of samples ever pushed, written only by the producer
+    std::atomic<uint64_t> _writeCount{0};
+
+    /// @brief First sample index of the latched frame window
+    uint64_t _frameBegin{0};
+
+    /// @brief One past the last sample index of the latched frame window
+    uint64_t _frameEnd{0};
+
+    // Private Methods
+};
+
+} // namespace velecs::input
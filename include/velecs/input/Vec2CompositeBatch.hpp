@@ -0,0 +1,193 @@
+/// @file    Vec2CompositeBatch.hpp
+/// @author  Matthew Green
+/// @date    2026-10-15 16:12:44
+///
+/// @section LICENSE
+///
+/// Copyright (c) 2026 Matthew Green - All rights reserved
+/// Unauthorized copying of this file, via any medium is strictly prohibited
+/// Proprietary and confidential
+
+#pragma once
+
+#include "velecs/input/InputBindings/Vec2Binding.hpp"
+#include "velecs/input/InputStatus.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace velecs::input {
+
+struct InputPollingState;
+
+/// @class Vec2CompositeBatch
+/// @brief Struct-of-arrays store that evaluates every composite-axis binding together
+///
+/// Vec2Binding::Evaluate() tests four keys for the current frame and four for the
+/// previous one, then runs a deadzone test, once per binding. Profiles with many
+/// movement composites repeat that work binding by binding. This batch keeps each
+/// field of Vec2Binding::Data in its own array instead, and Compute() evaluates them
+/// in groups of LANES:
+/// - the current key bits of the group's composites are gathered into float lanes
+/// - the axis vectors, their L-infinity norms and the deadzone test run four
+///   composites per instruction where SSE2 or NEON is available
+/// - the resulting vector and status are stored per composite
+///
+/// A composite's vector can only change when one of its keys does, so Compute() only
+/// recomputes the groups holding a composite that reads a key changed this frame,
+/// found through a reverse index from scancode to composites. Every other composite
+/// keeps its vector, and its status settles to Performed or Idle. A frame where no key
+/// changed therefore costs O(groups computed the frame before), not O(composites).
+///
+/// Whether each composite was past its deadzone is kept from the previous Compute()
+/// rather than recomputed from the previous frame's keys. Only the first Compute()
+/// after Clear() reads the previous frame, to seed that state. The caller must
+/// therefore call Compute() on every frame.
+///
+/// Evaluate() then only reads those results and fills the context. Results match
+/// Vec2Binding::Evaluate() exactly.
+///
+/// @code
+/// const uint32_t index = batch.Add(binding.GetData());
+/// batch.Compute(state);
+/// InputStatus status = batch.Evaluate(index, state, context);
+/// @endcode
+class Vec2CompositeBatch {
+public:
+    // Enums
+
+    // Public Fields
+
+    /// @brief Composites processed per vector instruction, arrays are padded to a multiple of this
+    static constexpr std::size_t LANES = 4;
+
+    // Constructors and Destructors
+
+    /// @brief Default constructor - creates an empty batch
+    Vec2CompositeBatch() = default;
+
+    /// @brief Default destructor
+    ~Vec2CompositeBatch() = default;
+
+    // Public Methods
+
+    /// @brief Removes every composite, keeping the arrays' capacity
+    void Clear();
+
+    /// @brief Appends a composite
+    /// @param data The binding's configuration
+    /// @return Index of the composite, passed to Evaluate()
+    uint32_t Add(const Vec2Binding::Data& data);
+
+    /// @brief Gets the number of composites in the batch
+    inline std::size_t GetCount() const { return _count; }
+
+    /// @brief Evaluates the composites whose keys changed against a frame's input
+    /// @param state Input state for the frame being evaluated
+    /// @note Must be called once on every frame, the edges of the previous frame's
+    ///       changes only end here
+    void Compute(const InputPollingState& state);
+
+    /// @brief Reads the result of one composite from the last Compute()
+    /// @param index Index returned by Add()
+    /// @param state Input state passed to the last Compute()
+    /// @param outContext Receives the composite's value and metadata
+    /// @return The composite's status this frame
+    InputStatus Evaluate(const uint32_t index, const InputPollingState& state, InputBindingContext& outContext) const;
+
+protected:
+    // Protected Fields
+
+    // Protected Methods
+
+private:
+    // Private Fields
+
+    /// @brief Number of composites, the arrays below may be longer due to padding
+    std::size_t _count{0};
+
+    std::vector<SDL_Scancode> _posXScancodes;
+    std::vector<SDL_Scancode> _negXScancodes;
+    std::vector<SDL_Scancode> _posYScancodes;
+    std::vector<SDL_Scancode> _negYScancodes;
+    std::vector<float> _deadzones;
+    std::vector<SDL_KeyboardID> _keyboardIds;
+
+    /// @brief Gathered current key bits as 0.0 or 1.0
+    std::vector<float> _posX, _negX, _posY, _negY;
+
+    /// @brief Current vector of each composite
+    std::vector<float> _valueX, _valueY;
+
+    /// @brief Status of each composite
+    std::vector<InputStatus> _statuses;
+
+    /// @brief One mask per group of LANES composites, bit N set if composite
+    ///        (group * LANES + N) was past its deadzone at the last Compute()
+    std::vector<uint32_t> _pastDeadzoneMasks;
+
+    /// @brief Whether _pastDeadzoneMasks holds state from a previous Compute()
+    bool _isSeeded{false};
+
+    /// @brief Reverse index offsets, composites reading scancode N are
+    ///        _keyComposites[_keyCompositeOffsets[N] .. _keyCompositeOffsets[N + 1])
+    std::vector<uint32_t> _keyCompositeOffsets;
+    std::vector<uint32_t> _keyComposites;
+
+    /// @brief Whether the reverse index covers every composite added so far
+    bool _isIndexed{false};
+
+    /// @brief Groups computed by the last Compute(), each listed once
+    std::vector<uint32_t> _computedGroups;
+
+    /// @brief Compute() stamp of each group's last listing in _computedGroups
+    std::vector<uint32_t> _groupStamps;
+
+    /// @brief Incremented by every Compute()
+    uint32_t _computeStamp{0};
+
+    // Private Methods
+
+    /// @brief Gets the configuration of one composite back as a Vec2Binding::Data
+    /// @param index Index returned by Add()
+    inline Vec2Binding::Data GetData(const uint32_t index) const
+    {
+        return Vec2Binding::Data{
+            _posXScancodes[index], _negXScancodes[index],
+            _posYScancodes[index], _negYScancodes[index],
+            _deadzones[index], _keyboardIds[index]
+        };
+    }
+
+    /// @brief Fills _pastDeadzoneMasks from the previous frame's keys
+    /// @param state Input state for the frame being evaluated
+    void Seed(const InputPollingState& state);
+
+    /// @brief Builds the reverse index from scancode to composites
+    void BuildKeyIndex();
+
+    /// @brief Lists a group in _computedGroups unless it is already listed this Compute()
+    /// @param group Index of the group, composite index divided by LANES
+    inline void MarkGroup(const uint32_t group)
+    {
+        if (_groupStamps[group] == _computeStamp) return;
+        _groupStamps[group] = _computeStamp;
+        _computedGroups.push_back(group);
+    }
+
+    /// @brief Ends the edges of LANES composites whose keys did not change
+    /// @param first Index of the first composite, a multiple of LANES
+    void SettleLanes(const std::size_t first);
+
+    /// @brief Gathers the current key bits of LANES composites
+    /// @param state Input state for the frame being evaluated
+    /// @param first Index of the first composite, a multiple of LANES
+    void GatherLanes(const InputPollingState& state, const std::size_t first);
+
+    /// @brief Computes vectors and statuses for LANES composites
+    /// @param first Index of the first composite, a multiple of LANES
+    void ComputeLanes(const std::size_t first);
+};
+
+} // namespace velecs::input
@@ -20,20 +20,35 @@ namespace velecs::input {
 
 // Public Methods
 
-void Action::Process(const InputPollingState& state)
+void Action::Process(const InputPollingState& state, const KeyBitset& claimedKeys)
 {
     if (!IsEnabled()) return;
 
+    // Per-binding keys are only gathered for the rare action a higher map partly claims
+    const bool isClaimed = _boundKeys.Intersects(claimedKeys);
+    KeyBitset bindingKeys;
+
     for (auto [uuid, name, binding] : _bindings)
     {
+        if (isClaimed)
+        {
+            bindingKeys.Clear();
+            binding.CollectKeys(bindingKeys);
+            if (bindingKeys.Intersects(claimedKeys)) continue;
+        }
+
+        InputBindingDetails details{};
         InputBindingContext context{};
-        context.activeKeymods = state.current.keymods;
+        context.activeKeymods = state.Current().keymods;
+        context.details = &details;
         Status status = binding.ProcessStatus(state, context);
-        if (HasAnyFlag(status, InputStatus::Started)) started.Invoke(context);
-        if (HasAnyFlag(status, InputStatus::Performed)) performed.Invoke(context);
-        if (HasAnyFlag(status, InputStatus::Cancelled)) cancelled.Invoke(context);
-        if (status != Status::Idle) break;
+        if (status == Status::Idle) continue;
+
+        Dispatch(status, context);
+        return;
     }
+
+    if (isClaimed) Interrupt(state);
 }
 
 // Protected Fields
@@ -44,4 +59,63 @@ void Action::Process(const InputPollingState& state)
 
 // Private Methods
 
+void Action::Dispatch(const Status bindingStatus, const InputBindingContext& context)
+{
+    const bool wasActive = _states.WasPerformedLastFrame(_stateIndex);
+    const bool isActive = HasAnyFlag(bindingStatus, InputStatus::Performed);
+
+    // An action that turns active without a start edge, because it was enabled, unclaimed
+    // or rebound while its input was held, still starts before it performs
+    Status status = bindingStatus;
+    if (isActive && !wasActive) status |= InputStatus::Started;
+
+    // A steady held input reports Performed alone, any edge adds Started or Cancelled
+    const bool isSteady = _triggerMode == TriggerMode::ValueChanged
+                       && status == InputStatus::Performed
+                       && _states.IsSameValue(_stateIndex, context);
+
+    _states.Write(_stateIndex, status, context);
+
+    // Both edges in one frame replay the sub-frame transitions in order. An action that
+    // was active was released first, so its cancel comes before the new start. One that
+    // was idle was pressed first, and if it ends active it was tapped and pressed again.
+    const bool hasBothEdges = HasAnyFlag(status, InputStatus::Started)
+                           && HasAnyFlag(status, InputStatus::Cancelled);
+
+    if (hasBothEdges && wasActive) Fire(ActionEventQueue::Kind::Cancelled, context);
+    if (HasAnyFlag(status, InputStatus::Started)) Fire(ActionEventQueue::Kind::Started, context);
+    if (hasBothEdges && !wasActive && isActive)
+    {
+        Fire(ActionEventQueue::Kind::Cancelled, context);
+        Fire(ActionEventQueue::Kind::Started, context);
+    }
+    if (isActive && !isSteady) Fire(ActionEventQueue::Kind::Performed, context);
+    if (HasAnyFlag(status, InputStatus::Cancelled) && !isActive) Fire(ActionEventQueue::Kind::Cancelled, context);
+}
+
+void Action::Interrupt(const InputPollingState& state)
+{
+    if (!_states.WasPerformedLastFrame(_stateIndex)) return;
+
+    InputBindingContext context{};
+    context.activeKeymods = state.Current().keymods;
+    Dispatch(Status::Cancelled, context);
+}
+
+void Action::Fire(const ActionEventQueue::Kind kind, const InputBindingContext& context)
+{
+    if (_deferredQueue != nullptr)
+    {
+        _deferredQueue->Push(*this, kind, context);
+        return;
+    }
+
+    switch (kind)
+    {
+        case ActionEventQueue::Kind::Started:   started.Invoke(context); break;
+        case ActionEventQueue::Kind::Performed: performed.Invoke(context); break;
+        case ActionEventQueue::Kind::Cancelled: cancelled.Invoke(context); break;
+    }
+}
+
 } // namespace velecs::input
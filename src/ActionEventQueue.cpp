@@ -0,0 +1,85 @@
+/// @file    ActionEventQueue.cpp
+/// @author  Matthew Green
+/// @date    2026-10-15 17:14:20
+///
+/// @section LICENSE
+///
+/// Copyright (c) 2026 Matthew Green - All rights reserved
+/// Unauthorized copying of this file, via any medium is strictly prohibited
+/// Proprietary and confidential
+
+#include "velecs/input/ActionEventQueue.hpp"
+
+#include "velecs/input/Action.hpp"
+
+#include <algorithm>
+
+namespace velecs::input {
+
+// Public Fields
+
+// Constructors and Destructors
+
+ActionEventQueue::ActionEventQueue()
+{
+    _events.reserve(DEFAULT_CAPACITY);
+    _dispatching.reserve(DEFAULT_CAPACITY);
+    _grouped.reserve(DEFAULT_CAPACITY);
+}
+
+// Public Methods
+
+std::size_t ActionEventQueue::Flush(const DispatchOrder order)
+{
+    std::size_t count = 0;
+
+    // Handlers may fire events while the batch runs, those land in _events for the next pass
+    while (!_events.empty())
+    {
+        _dispatching.swap(_events);
+        if (order == DispatchOrder::GroupedByAction) GroupByAction();
+
+        for (QueuedEvent& event : _dispatching)
+        {
+            // The evaluator's details lived on its stack, so point at the queued copy instead
+            event.context.details = &event.details;
+
+            switch (event.kind)
+            {
+                case Kind::Started:   event.action->started.Invoke(event.context); break;
+                case Kind::Performed: event.action->performed.Invoke(event.context); break;
+                case Kind::Cancelled: event.action->cancelled.Invoke(event.context); break;
+            }
+        }
+
+        count += _dispatching.size();
+        _dispatching.clear();
+    }
+    return count;
+}
+
+// Protected Fields
+
+// Protected Methods
+
+// Private Fields
+
+// Private Methods
+
+void ActionEventQueue::GroupByAction()
+{
+    // Counting sort on the state index, stable so an action's cancel still precedes its
+    // restart, and allocation free once the scratch buffers have grown
+    uint32_t maxIndex = 0;
+    for (const QueuedEvent& event : _dispatching) maxIndex = std::max(maxIndex, event.action->GetStateIndex());
+
+    _groupOffsets.assign(static_cast<std::size_t>(maxIndex) + 2, 0);
+    for (const QueuedEvent& event : _dispatching) ++_groupOffsets[event.action->GetStateIndex() + 1];
+    for (std::size_t i = 1; i < _groupOffsets.size(); ++i) _groupOffsets[i] += _groupOffsets[i - 1];
+
+    _grouped.resize(_dispatching.size());
+    for (const QueuedEvent& event : _dispatching) _grouped[_groupOffsets[event.action->GetStateIndex()]++] = event;
+    _dispatching.swap(_grouped);
+}
+
+} // namespace velecs::input
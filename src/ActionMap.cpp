@@ -20,36 +20,52 @@ namespace velecs::input {
 
 ActionMap& ActionMap::AddAction(const std::string& name, std::function<void(Action&)> configurator)
 {
+    _actionKeys.CheckCollision(name);
     auto [action, uuid] = _actions.Emplace(name, *this, name, Action::ConstructorKey{});
+    _actionKeys.Add(name, action);
+    _actionMask.Set(action.GetStateIndex());
+    BindingProgram::MarkStale();
     configurator(action);
     return *this;
 }
 
 void ActionMap::EnableAllActions()
 {
-    for (auto [uuid, name, action] : _actions)
-    {
-        action.Enable();
-    }
+    Action::EnableAll(_actionMask);
 }
 
 void ActionMap::DisableAllActions()
+{
+    Action::DisableAll(_actionMask);
+}
+
+void ActionMap::CollectBoundKeys(KeyBitset& outKeys)
 {
     for (auto [uuid, name, action] : _actions)
     {
-        action.Disable();
+        if (action.IsEnabled()) outKeys.SetAll(action.GetBoundKeys());
     }
 }
 
-void ActionMap::Process(const InputPollingState& state)
+void ActionMap::Process(const InputPollingState& state, const KeyBitset& claimedKeys)
 {
     if (!IsEnabled()) return;
 
+    _isHidden = false;
     for (auto [uuid, name, action] : _actions)
     {
-        if (!action.IsEnabled()) continue;
+        action.Process(state, claimedKeys);
+    }
+}
+
+void ActionMap::Hide(const InputPollingState& state)
+{
+    if (_isHidden) return;
 
-        action.Process(state);
+    _isHidden = true;
+    for (auto [uuid, name, action] : _actions)
+    {
+        if (action.IsEnabled()) action.Interrupt(state);
     }
 }
 
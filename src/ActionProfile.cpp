@@ -10,10 +10,13 @@
 
 #include "velecs/input/ActionProfile.hpp"
 
+#include "velecs/input/BindingProgram.hpp"
+
 #include "velecs/input/InputPollingState.hpp"
 #include "velecs/input/ActionMap.hpp"
 #include "velecs/input/Action.hpp"
 
+#include <algorithm>
 #include <stdexcept>
 
 namespace velecs::input {
@@ -31,20 +34,64 @@ ActionProfile::~ActionProfile() = default;
 
 ActionProfile& ActionProfile::AddMap(const std::string& name, std::function<void(ActionMap&)> configurator)
 {
+    _mapKeys.CheckCollision(name);
     auto [map, uuid] = _maps.Emplace(name, *this, name, ActionMap::ConstructorKey{});
+    _mapKeys.Add(name, map);
+    BindingProgram::MarkStale();
     configurator(map);
     return *this;
 }
 
+void ActionProfile::Enable()
+{
+    _enabled = true;
+    BindingProgram::MarkEnableChanged();
+}
+
+void ActionProfile::Disable()
+{
+    _enabled = false;
+    BindingProgram::MarkEnableChanged();
+}
+
+const std::vector<ActionMap*>& ActionProfile::GetMapStack()
+{
+    // Priorities and maps only change alongside the source revision, so sort at most once per change
+    if (_mapStackRevision == BindingProgram::GetSourceRevision()) return _mapStack;
+
+    _mapStack.clear();
+    for (auto [uuid, name, map] : _maps) _mapStack.push_back(&map);
+    std::stable_sort(_mapStack.begin(), _mapStack.end(), [](const ActionMap* a, const ActionMap* b)
+    {
+        return a->GetPriority() > b->GetPriority();
+    });
+
+    _mapStackRevision = BindingProgram::GetSourceRevision();
+    return _mapStack;
+}
+
 void ActionProfile::Process(const InputPollingState& state)
 {
     if (!IsEnabled()) return;
 
-    for (auto [uuid, name, map] : _maps)
+    KeyBitset claimedKeys;
+    bool isAllClaimed = false;
+    for (ActionMap* const map : GetMapStack())
     {
-        if (!map.IsEnabled()) continue;
+        if (!map->IsEnabled()) continue;
+
+        // Maps below a full claim are not evaluated, only cancelled once as the claim begins
+        if (isAllClaimed)
+        {
+            map->Hide(state);
+            continue;
+        }
+
+        map->Process(state, claimedKeys);
 
-        map.Process(state);
+        const ActionMap::InputConsumption consumption = map->GetInputConsumption();
+        if (consumption == ActionMap::InputConsumption::All) isAllClaimed = true;
+        if (consumption == ActionMap::InputConsumption::BoundKeys) map->CollectBoundKeys(claimedKeys);
     }
 }
 
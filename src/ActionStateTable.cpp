@@ -0,0 +1,99 @@
+/// @file    ActionStateTable.cpp
+/// @author  Matthew Green
+/// @date    2026-10-15 16:48:02
+///
+/// @section LICENSE
+///
+/// Copyright (c) 2026 Matthew Green - All rights reserved
+/// Unauthorized copying of this file, via any medium is strictly prohibited
+/// Proprietary and confidential
+
+#include "velecs/input/ActionStateTable.hpp"
+
+namespace velecs::input {
+
+// Public Fields
+
+// Constructors and Destructors
+
+// Public Methods
+
+uint32_t ActionStateTable::Allocate()
+{
+    if (!_freeSlots.empty())
+    {
+        const uint32_t index = _freeSlots.back();
+        _freeSlots.pop_back();
+        return index;
+    }
+
+    _statuses.push_back(InputStatus::Idle);
+    _valueTypes.push_back(ValueType::None);
+    _valueX.push_back(0.0f);
+    _valueY.push_back(0.0f);
+    _writtenFrames.push_back(0);
+    _generations.push_back(0);
+    return static_cast<uint32_t>(_statuses.size() - 1);
+}
+
+void ActionStateTable::Release(const uint32_t index)
+{
+    // A reused slot must not report the previous owner's state for the rest of the frame
+    _writtenFrames[index] = 0;
+    ++_generations[index];
+    _freeSlots.push_back(index);
+}
+
+void ActionStateTable::Write(const uint32_t index, const InputStatus status, const InputBindingContext& context)
+{
+    _statuses[index] = status;
+    _valueTypes[index] = context.valueType;
+    _writtenFrames[index] = _frame;
+    ToComponents(context, _valueX[index], _valueY[index]);
+}
+
+bool ActionStateTable::IsSameValue(const uint32_t index, const InputBindingContext& context) const
+{
+    if (_valueTypes[index] != context.valueType) return false;
+
+    float x = 0.0f;
+    float y = 0.0f;
+    ToComponents(context, x, y);
+    return _valueX[index] == x && _valueY[index] == y;
+}
+
+// Protected Fields
+
+// Protected Methods
+
+// Private Fields
+
+// Private Methods
+
+void ActionStateTable::ToComponents(const InputBindingContext& context, float& outX, float& outY)
+{
+    switch (context.valueType)
+    {
+        case ValueType::Bool:
+            outX = context.GetBool() ? 1.0f : 0.0f;
+            outY = 0.0f;
+            break;
+        case ValueType::Float:
+            outX = context.GetFloat();
+            outY = 0.0f;
+            break;
+        case ValueType::Vec2:
+        {
+            const velecs::math::Vec2 value = context.GetVec2();
+            outX = value.x;
+            outY = value.y;
+            break;
+        }
+        case ValueType::None:
+            outX = 0.0f;
+            outY = 0.0f;
+            break;
+    }
+}
+
+} // namespace velecs::input
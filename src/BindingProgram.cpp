@@ -0,0 +1,306 @@
+/// @file    BindingProgram.cpp
+/// @author  Matthew Green
+/// @date    2026-10-15 15:34:08
+///
+/// @section LICENSE
+///
+/// Copyright (c) 2026 Matthew Green - All rights reserved
+/// Unauthorized copying of this file, via any medium is strictly prohibited
+/// Proprietary and confidential
+
+#include "velecs/input/BindingProgram.hpp"
+
+#include "velecs/input/InputPollingState.hpp"
+#include "velecs/input/ActionProfile.hpp"
+#include "velecs/input/ActionMap.hpp"
+#include "velecs/input/Action.hpp"
+
+#include <algorithm>
+#include <utility>
+
+namespace velecs::input {
+
+// Public Fields
+
+// Constructors and Destructors
+
+// Public Methods
+
+void BindingProgram::Build(ActionProfileRegistry& profiles)
+{
+    _maps.clear();
+    _actions.clear();
+    _bindings.clear();
+    _virtualBindings.clear();
+    _buttonBindings.clear();
+    _vec2Batch.Clear();
+    _mouseButtonBindings.clear();
+    _mouseDeltaBindings.clear();
+    _alwaysActions.clear();
+
+    // Actions are first recorded against each key they read, then packed into the reverse index
+    std::vector<std::pair<uint32_t, uint32_t>> keyActionPairs;
+    KeyBitset actionKeys;
+
+    for (auto [name, uuid, profile] : profiles)
+    {
+        for (ActionMap* const map : profile.GetMapStack())
+        {
+            _maps.push_back(MapRange{&profile, map, static_cast<uint32_t>(_actions.size()), 0});
+
+            for (auto [actionUuid, actionName, action] : map->_actions)
+            {
+                const uint32_t actionIndex = static_cast<uint32_t>(_actions.size());
+                ActionRange range{&profile, map, &action, static_cast<uint32_t>(_bindings.size()), 0};
+
+                actionKeys.Clear();
+                bool isKeyDriven = true;
+                for (auto [bindingUuid, bindingName, binding] : action._bindings)
+                {
+                    _bindings.push_back(Compile(binding));
+                    isKeyDriven = binding.CollectKeys(actionKeys) && isKeyDriven;
+                }
+                range.bindingCount = static_cast<uint32_t>(_bindings.size()) - range.firstBinding;
+                _actions.push_back(range);
+
+                if (!isKeyDriven)
+                {
+                    _alwaysActions.push_back(actionIndex);
+                    continue;
+                }
+                for (const SDL_Scancode scancode : actionKeys)
+                {
+                    keyActionPairs.emplace_back(static_cast<uint32_t>(scancode), actionIndex);
+                }
+            }
+
+            _maps.back().actionCount = static_cast<uint32_t>(_actions.size()) - _maps.back().firstAction;
+        }
+    }
+
+    _keyActionOffsets.assign(KeyBitset::BIT_COUNT + 1, 0);
+    for (const auto& [scancode, actionIndex] : keyActionPairs) ++_keyActionOffsets[scancode + 1];
+    for (std::size_t i = 1; i < _keyActionOffsets.size(); ++i) _keyActionOffsets[i] += _keyActionOffsets[i - 1];
+
+    _keyActions.resize(keyActionPairs.size());
+    std::vector<uint32_t> cursor(_keyActionOffsets.begin(), _keyActionOffsets.end() - 1);
+    for (const auto& [scancode, actionIndex] : keyActionPairs) _keyActions[cursor[scancode]++] = actionIndex;
+
+    // Evaluate everything once so actions held across the rebuild resume emitting performed
+    _activeActions.resize(_actions.size());
+    for (uint32_t i = 0; i < _activeActions.size(); ++i) _activeActions[i] = i;
+
+    _queuedStamps.assign(_actions.size(), 0);
+    _enabledFlags.assign(_actions.size(), 0);
+    _claimedFlags.assign(_bindings.size(), 0);
+    _refreshedEnableRevision = ~uint64_t{0};
+    _frameStamp = 0;
+    _worklist.clear();
+    _worklist.reserve(_actions.size());
+
+    _builtRevision = _sourceRevision;
+}
+
+void BindingProgram::Execute(const InputPollingState& state)
+{
+    ++_frameStamp;
+    _worklist.clear();
+
+    if (_refreshedEnableRevision != _enableRevision) RefreshEnabled();
+
+    for (const uint32_t actionIndex : _activeActions) Enqueue(actionIndex);
+    for (const uint32_t actionIndex : _alwaysActions) Enqueue(actionIndex);
+
+    const bool isJournaled = state.ForEachChangedKey([this](const SDL_Scancode scancode)
+    {
+        const std::size_t index = static_cast<std::size_t>(scancode);
+        if (index >= KeyBitset::BIT_COUNT) return;
+        for (uint32_t i = _keyActionOffsets[index]; i < _keyActionOffsets[index + 1]; ++i) Enqueue(_keyActions[i]);
+    });
+    if (!isJournaled)
+    {
+        for (uint32_t i = 0; i < _actions.size(); ++i) Enqueue(i);
+    }
+
+    // Keep callbacks in the same order as a full walk
+    std::sort(_worklist.begin(), _worklist.end());
+
+    // Composites carry their deadzone state between frames, so the batch runs every frame,
+    // even if every composite reading a changed key is disabled
+    if (_vec2Batch.GetCount() != 0) _vec2Batch.Compute(state);
+
+    const SDL_Keymod keymods = state.Current().keymods;
+    const BindingRecord* const records = _bindings.data();
+
+    _activeActions.clear();
+    for (const uint32_t actionIndex : _worklist)
+    {
+        const ActionRange& range = _actions[actionIndex];
+
+        // Only RefreshEnabled() queues an action it left disabled, because a map above claimed it
+        if (!_enabledFlags[actionIndex])
+        {
+            range.action->Interrupt(state);
+            continue;
+        }
+
+        // A handler earlier in this frame may have disabled the action
+        if (_refreshedEnableRevision != _enableRevision
+            && (!range.profile->IsEnabled() || !range.map->IsEnabled() || !range.action->IsEnabled()))
+        {
+            // Kept queued so it is rechecked once the next refresh finds it enabled again
+            _activeActions.push_back(actionIndex);
+            continue;
+        }
+
+        bool hasClaimedBinding = false;
+        bool isDispatched = false;
+        const BindingRecord* const end = records + range.firstBinding + range.bindingCount;
+        for (const BindingRecord* record = records + range.firstBinding; record != end; ++record)
+        {
+            if (_claimedFlags[record - records])
+            {
+                hasClaimedBinding = true;
+                continue;
+            }
+
+            InputBindingDetails details{};
+            InputBindingContext context{};
+            context.activeKeymods = keymods;
+            context.details = &details;
+            const InputStatus status = Evaluate(*record, state, context);
+            if (status == InputStatus::Idle) continue;
+
+            // Another binding may still be held after this one cancels, so any activity
+            // keeps the action queued until a frame where every binding is Idle
+            range.action->Dispatch(status, context);
+            _activeActions.push_back(actionIndex);
+            isDispatched = true;
+            break;
+        }
+
+        // Nothing left active once the held binding was claimed
+        if (!isDispatched && hasClaimedBinding) range.action->Interrupt(state);
+    }
+}
+
+// Protected Fields
+
+// Protected Methods
+
+// Private Fields
+
+// Private Methods
+
+void BindingProgram::RefreshEnabled()
+{
+    const ActionProfile* profile = nullptr;
+    KeyBitset claimedKeys;
+    KeyBitset bindingKeys;
+    bool isAllClaimed = false;
+
+    for (const MapRange& mapRange : _maps)
+    {
+        // Claims only hide input from lower maps of the same profile
+        if (mapRange.profile != profile)
+        {
+            profile = mapRange.profile;
+            claimedKeys.Clear();
+            isAllClaimed = false;
+        }
+
+        const bool isMapEnabled = profile->IsEnabled() && mapRange.map->IsEnabled();
+        const ActionMap::InputConsumption consumption = mapRange.map->GetInputConsumption();
+        KeyBitset mapKeys;
+
+        for (uint32_t i = mapRange.firstAction; i < mapRange.firstAction + mapRange.actionCount; ++i)
+        {
+            const ActionRange& range = _actions[i];
+            const Action& action = *range.action;
+            const bool isActionEnabled = isMapEnabled && action.IsEnabled();
+            if (isActionEnabled && consumption == ActionMap::InputConsumption::BoundKeys) mapKeys.SetAll(action.GetBoundKeys());
+
+            // Only the bindings reading a claimed key are hidden, the rest of the action still runs
+            uint32_t claimedCount = 0;
+            bool isAnyUnclaimed = false;
+            const bool isClaimed = isAllClaimed || action.GetBoundKeys().Intersects(claimedKeys);
+            uint32_t bindingIndex = range.firstBinding;
+            for (auto [bindingUuid, bindingName, binding] : action._bindings)
+            {
+                bool isBindingClaimed = isAllClaimed;
+                if (isClaimed && !isBindingClaimed)
+                {
+                    bindingKeys.Clear();
+                    binding.CollectKeys(bindingKeys);
+                    isBindingClaimed = bindingKeys.Intersects(claimedKeys);
+                }
+                isAnyUnclaimed = isAnyUnclaimed || (_claimedFlags[bindingIndex] && !isBindingClaimed);
+                _claimedFlags[bindingIndex++] = isBindingClaimed;
+                claimedCount += isBindingClaimed;
+            }
+
+            const bool isFullyClaimed = isAllClaimed || (claimedCount != 0 && claimedCount == range.bindingCount);
+            const uint8_t isEnabled = isActionEnabled && !isFullyClaimed;
+
+            // Input may have changed while disabled or claimed, so evaluate the action once
+            const bool isNewlyEnabled = isEnabled && !_enabledFlags[i];
+            _enabledFlags[i] = isEnabled;
+            if (isNewlyEnabled || isAnyUnclaimed) Enqueue(i);
+
+            // Claimed actions are queued once so Execute() can cancel any that were held
+            if (isActionEnabled && claimedCount != 0 && _queuedStamps[i] != _frameStamp)
+            {
+                _queuedStamps[i] = _frameStamp;
+                _worklist.push_back(i);
+            }
+        }
+
+        // A map's claims apply from the next map down, never to its own actions
+        if (!isMapEnabled) continue;
+        if (consumption == ActionMap::InputConsumption::All) isAllClaimed = true;
+        claimedKeys.SetAll(mapKeys);
+    }
+    _refreshedEnableRevision = _enableRevision;
+}
+
+BindingProgram::BindingRecord BindingProgram::Compile(const InputBinding& binding)
+{
+    // Runs once per binding per rebuild, so the casts never reach the per-frame path
+    if (const auto* button = dynamic_cast<const ButtonBinding*>(&binding))
+    {
+        _buttonBindings.push_back(button->GetData());
+        return BindingRecord{BindingKind::Button, static_cast<uint32_t>(_buttonBindings.size() - 1)};
+    }
+    if (const auto* vec2 = dynamic_cast<const Vec2Binding*>(&binding))
+    {
+        return BindingRecord{BindingKind::Vec2, _vec2Batch.Add(vec2->GetData())};
+    }
+    if (const auto* mouseButton = dynamic_cast<const MouseButtonBinding*>(&binding))
+    {
+        _mouseButtonBindings.push_back(mouseButton->GetData());
+        return BindingRecord{BindingKind::MouseButton, static_cast<uint32_t>(_mouseButtonBindings.size() - 1)};
+    }
+    if (const auto* mouseDelta = dynamic_cast<const MouseDeltaBinding*>(&binding))
+    {
+        _mouseDeltaBindings.push_back(mouseDelta->GetData());
+        return BindingRecord{BindingKind::MouseDelta, static_cast<uint32_t>(_mouseDeltaBindings.size() - 1)};
+    }
+
+    _virtualBindings.push_back(&binding);
+    return BindingRecord{BindingKind::Virtual, static_cast<uint32_t>(_virtualBindings.size() - 1)};
+}
+
+InputStatus BindingProgram::Evaluate(const BindingRecord& record, const InputPollingState& state, InputBindingContext& outContext) const
+{
+    switch (record.kind)
+    {
+        case BindingKind::Vec2:        return _vec2Batch.Evaluate(record.index, state, outContext);
+        case BindingKind::Button:      return ButtonBinding::Evaluate(_buttonBindings[record.index], state, outContext);
+        case BindingKind::MouseButton: return MouseButtonBinding::Evaluate(_mouseButtonBindings[record.index], state, outContext);
+        case BindingKind::MouseDelta:  return MouseDeltaBinding::Evaluate(_mouseDeltaBindings[record.index], state, outContext);
+        case BindingKind::Virtual:     break;
+    }
+    return _virtualBindings[record.index]->ProcessStatus(state, outContext);
+}
+
+} // namespace velecs::input
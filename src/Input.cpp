@@ -11,14 +11,22 @@
 #include "velecs/input/Input.hpp"
 
 #include "velecs/input/InputPollingState.hpp"
+#include "velecs/input/BindingProgram.hpp"
 #include "velecs/input/ActionProfile.hpp"
 #include "velecs/input/ActionMap.hpp"
 #include "velecs/input/Action.hpp"
 #include "velecs/input/InputBindings/Common.hpp"
+#include "velecs/input/ProfileImage.hpp"
+#include "velecs/input/ProfileCompiler.hpp"
+#include "velecs/input/ProfileWatcher.hpp"
 
 using namespace velecs::common;
 
+#include <algorithm>
+#include <chrono>
 #include <iostream>
+#include <stdexcept>
+#include <string_view>
 
 namespace velecs::input {
 
@@ -30,101 +38,162 @@ namespace velecs::input {
 
 void Input::ProcessEvent(const SDL_Event* const event)
 {
-    switch (event->type)
+    switch (ClassifyEvent(event->type))
     {
-        // Keyboard Events
-        case SDL_EVENT_KEY_DOWN:
-        {
-            SDL_KeyboardID keyboardId = event->key.which;
-            SDL_Scancode scancode = event->key.scancode;
-            _state.current.RegisterKey(scancode);
-            // _state.current.RegisterKey(keyboardId, scancode);
-            break;
-        }
-        case SDL_EVENT_KEY_UP:
-        {
-            
-            SDL_KeyboardID keyboardId = event->key.which;
-            SDL_Scancode scancode = event->key.scancode;
-            _state.current.UnregisterKey(scancode);
-            // _state.current.UnregisterKey(keyboardId, scancode);
-            break;
-        }
+        case EventCategory::Keyboard: ProcessKeyboardEvent(event); break;
+        case EventCategory::Mouse:    ProcessMouseEvent(event);    break;
+        case EventCategory::Gamepad:  ProcessGamepadEvent(event);  break;
+        case EventCategory::Other:                                 break;
+    }
+}
 
-        case SDL_EVENT_KEYBOARD_ADDED:
-        {
-            SDL_KeyboardID keyboardId = event->kdevice.which;
-            // _state.current.RegistryKeyboard(keyboardId);
-            break;
-        }
-        case SDL_EVENT_KEYBOARD_REMOVED:
+InputEventStats Input::ProcessEvents(const SDL_Event* const events, const std::size_t count)
+{
+    InputEventStats stats;
+
+    // Events are split into per-category index lists a chunk at a time. Categories touch
+    // disjoint state, so only the order within a category has to be preserved.
+    constexpr std::size_t CHUNK_SIZE = 256;
+    uint16_t keyboardEvents[CHUNK_SIZE];
+    uint16_t mouseEvents[CHUNK_SIZE];
+    uint16_t gamepadEvents[CHUNK_SIZE];
+
+    for (std::size_t chunkStart = 0; chunkStart < count; chunkStart += CHUNK_SIZE)
+    {
+        const SDL_Event* const chunk = events + chunkStart;
+        const std::size_t chunkSize = std::min(CHUNK_SIZE, count - chunkStart);
+
+        std::size_t keyboardCount = 0;
+        std::size_t mouseCount = 0;
+        std::size_t gamepadCount = 0;
+        for (std::size_t i = 0; i < chunkSize; ++i)
         {
-            SDL_KeyboardID keyboardId = event->kdevice.which;
-            // _state.current.UnregisterKeyboard(keyboardId);
-            break;
+            switch (ClassifyEvent(chunk[i].type))
+            {
+                case EventCategory::Keyboard: keyboardEvents[keyboardCount++] = static_cast<uint16_t>(i); break;
+                case EventCategory::Mouse:    mouseEvents[mouseCount++] = static_cast<uint16_t>(i);       break;
+                case EventCategory::Gamepad:  gamepadEvents[gamepadCount++] = static_cast<uint16_t>(i);   break;
+                case EventCategory::Other:    ++stats.otherEvents;                                        break;
+            }
         }
 
-        // Gamepad Events
-        case SDL_EVENT_GAMEPAD_AXIS_MOTION:
+        for (std::size_t i = 0; i < keyboardCount; ++i) ProcessKeyboardEvent(&chunk[keyboardEvents[i]]);
+
+        // Motion and wheel are summed locally and applied before the next button event, so
+        // a click still sees the cursor position of the motion that preceded it
+        float mouseDeltaX = 0.0f;
+        float mouseDeltaY = 0.0f;
+        float mouseWheelX = 0.0f;
+        float mouseWheelY = 0.0f;
+        const SDL_MouseMotionEvent* lastMotion = nullptr;
+        const auto applyPendingMotion = [&]()
         {
-            SDL_JoystickID gamepadId = event->gaxis.which;
-            SDL_GamepadAxis axis = (SDL_GamepadAxis)event->gaxis.axis;
-            // Normalize to -1.0 to 1.0 (or 0.0 to 1.0 if a trigger or similar)
-            float normalizedValue = std::clamp(event->gaxis.value / 32767.0f, -1.0f, 1.0f);
-            // _state.current.RegisterGamepadAxis(gamepadId, axis, normalizedValue);
-            break;
-        }
-        case SDL_EVENT_GAMEPAD_BUTTON_DOWN:
+            if (lastMotion != nullptr) _state.RegisterMouseMotion(lastMotion->x, lastMotion->y, mouseDeltaX, mouseDeltaY);
+            if (mouseWheelX != 0.0f || mouseWheelY != 0.0f) _state.RegisterMouseWheel(mouseWheelX, mouseWheelY);
+            mouseDeltaX = mouseDeltaY = mouseWheelX = mouseWheelY = 0.0f;
+            lastMotion = nullptr;
+        };
+        for (std::size_t i = 0; i < mouseCount; ++i)
         {
-            SDL_JoystickID gamepadId = event->gbutton.which;
-            SDL_GamepadButton gamepadButton = (SDL_GamepadButton)event->gbutton.button;
-            // _state.current.RegisterGamepadButton(gamepadId, gamepadButton);
-            break;
+            const SDL_Event& event = chunk[mouseEvents[i]];
+            if (event.type == SDL_EVENT_MOUSE_MOTION)
+            {
+                mouseDeltaX += event.motion.xrel;
+                mouseDeltaY += event.motion.yrel;
+                lastMotion = &event.motion;
+                ++stats.coalescedMotionEvents;
+            }
+            else if (event.type == SDL_EVENT_MOUSE_WHEEL)
+            {
+                const float direction = event.wheel.direction == SDL_MOUSEWHEEL_FLIPPED ? -1.0f : 1.0f;
+                mouseWheelX += event.wheel.x * direction;
+                mouseWheelY += event.wheel.y * direction;
+            }
+            else
+            {
+                applyPendingMotion();
+                ProcessMouseEvent(&event);
+            }
         }
-        case SDL_EVENT_GAMEPAD_BUTTON_UP:
+        applyPendingMotion();
+
+        for (std::size_t i = 0; i < gamepadCount; ++i) ProcessGamepadEvent(&chunk[gamepadEvents[i]]);
+
+        stats.keyboardEvents += keyboardCount;
+        stats.mouseEvents += mouseCount;
+        stats.gamepadEvents += gamepadCount;
+    }
+
+    return stats;
+}
+
+void Input::Update()
+{
+    // Applied at the frame boundary, so evaluation never sees half of a reload
+    std::unique_ptr<ProfileImage> reloadedImage;
+    if (_profileWatcher != nullptr && _profileWatcher->TryTakeImage(reloadedImage))
+    {
+        // LoadProfiles() checks the image before changing anything, so a failure keeps the last good profiles
+        try
         {
-            SDL_JoystickID gamepadId = event->gbutton.which;
-            SDL_GamepadButton gamepadButton = (SDL_GamepadButton)event->gbutton.button;
-            // _state.current.UnregisterGamepadButton(gamepadId, gamepadButton);
-            break;
+            LoadProfiles(*reloadedImage);
         }
-        case SDL_EVENT_GAMEPAD_ADDED:
+        catch (const std::exception& error)
         {
-            SDL_JoystickID gamepadId = event->gdevice.which;
-            // _state.current.RegisterGamepad(gamepadId);
-            break;
+            _profileWatcher->ReportError(error.what());
         }
-        case SDL_EVENT_GAMEPAD_REMOVED:
+    }
+
+    using Clock = std::chrono::steady_clock;
+    const Clock::time_point evaluationStart = Clock::now();
+
+    _state.SetKeymods(SDL_GetModState());
+    _state.SetFrameTimestamp(SDL_GetTicksNS());
+    _state.UpdateEdges();
+    Action::_states.AdvanceFrame();
+
+    if (_compiledUpdate)
+    {
+        if (_program.IsStale()) _program.Build(_profiles);
+        _program.Execute(_state);
+    }
+    else
+    {
+        for (auto [name, uuid, profile] : _profiles)
         {
-            SDL_JoystickID gamepadId = event->gdevice.which;
-            // _state.current.UnregisterGamepad(gamepadId);
-            break;
+            if (!profile.IsEnabled()) continue;
+
+            profile.Process(_state);
         }
-        case SDL_EVENT_GAMEPAD_REMAPPED:             /**< The gamepad mapping was updated */
-        case SDL_EVENT_GAMEPAD_TOUCHPAD_DOWN:        /**< Gamepad touchpad was touched */
-        case SDL_EVENT_GAMEPAD_TOUCHPAD_MOTION:      /**< Gamepad touchpad finger was moved */
-        case SDL_EVENT_GAMEPAD_TOUCHPAD_UP:          /**< Gamepad touchpad finger was lifted */
-        case SDL_EVENT_GAMEPAD_SENSOR_UPDATE:        /**< Gamepad sensor was updated */
-        case SDL_EVENT_GAMEPAD_UPDATE_COMPLETE:      /**< Gamepad update is complete */
-        case SDL_EVENT_GAMEPAD_STEAM_HANDLE_UPDATED: /**< Gamepad Steam handle has changed */
-            break;
     }
-}
 
-void Input::Update()
-{
-    _state.current.keymods = SDL_GetModState();
+    const Clock::time_point evaluationEnd = Clock::now();
+    _updateStats.evaluationNs = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(evaluationEnd - evaluationStart).count());
+    _updateStats.dispatchNs = 0;
+    _updateStats.dispatchedEvents = 0;
 
-    for (auto [name, uuid, profile] : _profiles)
+    if (!_eventQueue.IsEmpty())
     {
-        if (!profile.IsEnabled()) continue;
-
-        profile.Process(_state);
+        _updateStats.dispatchedEvents = _eventQueue.Flush(_dispatchOrder);
+        _updateStats.dispatchNs = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - evaluationEnd).count());
     }
 
     _state.ShiftFrame();
 }
 
+void Input::SetCompiledUpdate(const bool enabled)
+{
+    // The worklist and composite state stop tracking while the tree is walked
+    if (enabled && !_compiledUpdate) BindingProgram::MarkStale();
+    _compiledUpdate = enabled;
+}
+
+void Input::SetDeferredDispatch(const bool enabled)
+{
+    _deferredDispatch = enabled;
+    Action::_deferredQueue = enabled ? &_eventQueue : nullptr;
+}
+
 bool Input::IsKeyStarted(const SDL_Scancode scancode)
 {
     return _state.IsKeyStarted(scancode);
@@ -140,12 +209,166 @@ bool Input::IsKeyCancelled(const SDL_Scancode scancode)
     return _state.IsKeyCancelled(scancode);
 }
 
+bool Input::IsKeyStarted(const SDL_KeyboardID keyboardId, const SDL_Scancode scancode)
+{
+    return _state.IsKeyStarted(keyboardId, scancode);
+}
+
+bool Input::IsKeyPerformed(const SDL_KeyboardID keyboardId, const SDL_Scancode scancode)
+{
+    return _state.IsKeyPerformed(keyboardId, scancode);
+}
+
+bool Input::IsKeyCancelled(const SDL_KeyboardID keyboardId, const SDL_Scancode scancode)
+{
+    return _state.IsKeyCancelled(keyboardId, scancode);
+}
+
+bool Input::IsGamepadButtonStarted(const SDL_JoystickID gamepadId, const SDL_GamepadButton button)
+{
+    return _state.IsGamepadButtonStarted(gamepadId, button);
+}
+
+bool Input::IsGamepadButtonPerformed(const SDL_JoystickID gamepadId, const SDL_GamepadButton button)
+{
+    return _state.IsGamepadButtonPerformed(gamepadId, button);
+}
+
+bool Input::IsGamepadButtonCancelled(const SDL_JoystickID gamepadId, const SDL_GamepadButton button)
+{
+    return _state.IsGamepadButtonCancelled(gamepadId, button);
+}
+
+float Input::GetGamepadAxis(const SDL_JoystickID gamepadId, const SDL_GamepadAxis axis)
+{
+    return _state.GetGamepadAxis(gamepadId, axis);
+}
+
+bool Input::IsMouseButtonStarted(const uint8_t button)
+{
+    return _state.IsMouseButtonStarted(button);
+}
+
+bool Input::IsMouseButtonPerformed(const uint8_t button)
+{
+    return _state.IsMouseButtonPerformed(button);
+}
+
+bool Input::IsMouseButtonCancelled(const uint8_t button)
+{
+    return _state.IsMouseButtonCancelled(button);
+}
+
+velecs::math::Vec2 Input::GetMousePosition()
+{
+    return _state.GetMousePosition();
+}
+
+velecs::math::Vec2 Input::GetMouseDelta()
+{
+    // ShiftFrame has already started the next frame, so the finished frame is Previous()
+    const PollingData& finished = _state.Previous();
+    return velecs::math::Vec2{finished.mouseDeltaX, finished.mouseDeltaY};
+}
+
+velecs::math::Vec2 Input::GetMouseWheel()
+{
+    const PollingData& finished = _state.Previous();
+    return velecs::math::Vec2{finished.mouseWheelX, finished.mouseWheelY};
+}
+
+SampleSpan<SensorSample> Input::GetGamepadSensorSamples(const SDL_JoystickID gamepadId, const GamepadSensor sensor)
+{
+    return _state.GetGamepadSensorSamples(gamepadId, sensor);
+}
+
+SampleSpan<TouchpadSample> Input::GetGamepadTouchpadSamples(const SDL_JoystickID gamepadId)
+{
+    return _state.GetGamepadTouchpadSamples(gamepadId);
+}
+
+const KeyBitset& Input::GetStartedKeys()
+{
+    return _state.GetStartedKeys();
+}
+
+const KeyBitset& Input::GetPerformedKeys()
+{
+    return _state.GetPerformedKeys();
+}
+
+const KeyBitset& Input::GetCancelledKeys()
+{
+    return _state.GetCancelledKeys();
+}
+
 ActionProfile& Input::CreateProfile(const std::string& name)
 {
+    _profileKeys.CheckCollision(name);
     auto [profile, uuid] = _profiles.Emplace(name, name, ActionProfile::ConstructorKey{});
+    _profileKeys.Add(name, profile);
+    BindingProgram::MarkStale();
     return profile;
 }
 
+void Input::LoadProfiles(const ProfileImage& image)
+{
+    CheckLoad(image);
+
+    for (uint32_t p = 0; p < image.GetProfileCount(); ++p)
+    {
+        const ProfileImage::ProfileRecord& record = image.GetProfiles()[p];
+        const std::string name(image.GetString(record.name));
+
+        ActionProfile* profile = nullptr;
+        if (!TryGetProfile(name, profile)) profile = &CreateProfile(name);
+        if (record.enabled) profile->Enable();
+        else profile->Disable();
+
+        // The image is authoritative for its profiles, so maps it no longer lists are disabled
+        std::vector<ActionMap*> unlistedMaps = profile->GetMapStack();
+        for (uint32_t m = record.firstMap; m < record.firstMap + record.mapCount; ++m)
+        {
+            const std::string mapName(image.GetString(image.GetMaps()[m].name));
+
+            ActionMap* map = nullptr;
+            if (!profile->TryGetMap(mapName, map)) profile->AddMap(mapName, [&map](ActionMap& added) { map = &added; });
+            unlistedMaps.erase(std::remove(unlistedMaps.begin(), unlistedMaps.end(), map), unlistedMaps.end());
+
+            LoadMap(image, m, *map);
+        }
+        for (ActionMap* const map : unlistedMaps) map->Disable();
+    }
+}
+
+void Input::LoadProfiles(const std::string& path)
+{
+    LoadProfiles(ProfileImage::MapFile(path));
+}
+
+std::vector<uint8_t> Input::SerializeProfiles()
+{
+    return ProfileCompiler::Serialize(_profiles);
+}
+
+void Input::WatchProfiles(const std::string& path)
+{
+    // Watch before the first load, so a save made while loading is not missed
+    std::unique_ptr<ProfileWatcher> watcher = std::make_unique<ProfileWatcher>(path);
+    LoadProfiles(ProfileWatcher::Compile(path));
+    _profileWatcher = std::move(watcher);
+}
+
+void Input::StopWatchingProfiles()
+{
+    _profileWatcher.reset();
+}
+
+const ProfileWatcher* Input::GetProfileWatcher()
+{
+    return _profileWatcher.get();
+}
+
 void Input::CreateDefaultProfile()
 {
     std::cout << "Creating profile..." << std::endl;
@@ -154,15 +377,15 @@ void Input::CreateDefaultProfile()
             std::cout << map.GetName() << std::endl;
             map.AddAction("Jump", [](Action& action){
                 action.AddBinding<ButtonBinding>("PC Jump", SDL_SCANCODE_SPACE);
-                action.started += [](InputBindingContext ctx) { std::cout << "Pressed jump button." << std::endl; };
-                action.cancelled += [](InputBindingContext ctx) { std::cout << "Released jump button." << std::endl; };
+                action.started += [](const InputBindingContext& ctx) { std::cout << "Pressed jump button." << std::endl; };
+                action.cancelled += [](const InputBindingContext& ctx) { std::cout << "Released jump button." << std::endl; };
             })
             .AddAction("Move", [](Action& action){
                 std::cout << action.GetName() << std::endl;
                 action.AddBinding<Vec2Binding>("WASD Move", SDL_SCANCODE_D, SDL_SCANCODE_A, SDL_SCANCODE_W, SDL_SCANCODE_S, 0.1f)
                     .AddBinding<Vec2Binding>("Arrow Keys Move", SDL_SCANCODE_RIGHT, SDL_SCANCODE_LEFT, SDL_SCANCODE_UP, SDL_SCANCODE_DOWN, 0.1f);
 
-                action.performed += [](InputBindingContext ctx)
+                action.performed += [](const InputBindingContext& ctx)
                 {
                     bool isWalking = (ctx.activeKeymods & SDL_KMOD_LSHIFT) == SDL_KMOD_NONE;
                     if (isWalking)
@@ -189,6 +412,367 @@ InputPollingState Input::_state;
 
 ActionProfileRegistry Input::_profiles;
 
+NameKeyIndex<ActionProfile> Input::_profileKeys;
+
+BindingProgram Input::_program;
+
+bool Input::_compiledUpdate{false};
+
+ActionEventQueue Input::_eventQueue;
+
+bool Input::_deferredDispatch{false};
+
+ActionEventQueue::DispatchOrder Input::_dispatchOrder{ActionEventQueue::DispatchOrder::Recorded};
+
+InputUpdateStats Input::_updateStats;
+
+std::unique_ptr<ProfileWatcher> Input::_profileWatcher;
+
 // Private Methods
 
+void Input::LoadMap(const ProfileImage& image, const uint32_t mapIndex, ActionMap& map)
+{
+    const ProfileImage::MapRecord& record = image.GetMaps()[mapIndex];
+
+    // Only touch what changed, an identical reload then needs no program rebuild
+    if (map.GetPriority() != record.priority) map.SetPriority(record.priority);
+    const auto consumption = static_cast<ActionMap::InputConsumption>(record.inputConsumption);
+    if (map.GetInputConsumption() != consumption) map.SetInputConsumption(consumption);
+    if (record.enabled) map.Enable();
+    else map.Disable();
+
+    std::vector<Action*> unlistedActions;
+    for (auto [uuid, name, action] : map._actions) unlistedActions.push_back(&action);
+
+    for (uint32_t a = record.firstAction; a < record.firstAction + record.actionCount; ++a)
+    {
+        const std::string actionName(image.GetString(image.GetActions()[a].name));
+
+        Action* action = nullptr;
+        if (!map.TryGetAction(actionName, action)) map.AddAction(actionName, [&action](Action& added) { action = &added; });
+        unlistedActions.erase(std::remove(unlistedActions.begin(), unlistedActions.end(), action), unlistedActions.end());
+
+        LoadAction(image, a, *action);
+    }
+    for (Action* const action : unlistedActions) action->Disable();
+}
+
+void Input::CheckLoad(const ProfileImage& image)
+{
+    // Throws if two different names of one group share a NameKey, or one of them would
+    // share the key of a different existing name through tryGetExisting
+    const auto checkGroup = [](std::vector<std::string_view>& names, const auto& tryGetExisting)
+    {
+        std::sort(names.begin(), names.end(), [](const std::string_view a, const std::string_view b)
+        {
+            return NameKey{a} < NameKey{b};
+        });
+        for (std::size_t i = 0; i < names.size(); ++i)
+        {
+            const NameKey key{names[i]};
+            if (i > 0 && NameKey{names[i - 1]} == key && names[i - 1] != names[i])
+            {
+                throw std::runtime_error("Name '" + std::string(names[i]) + "' has the same NameKey as '" + std::string(names[i - 1]) + "'");
+            }
+
+            std::string_view existingName;
+            if (tryGetExisting(key, existingName) && existingName != names[i])
+            {
+                throw std::runtime_error("Name '" + std::string(names[i]) + "' has the same NameKey as '" + std::string(existingName) + "'");
+            }
+        }
+    };
+
+    std::vector<std::string_view> names;
+    for (uint32_t p = 0; p < image.GetProfileCount(); ++p) names.push_back(image.GetString(image.GetProfiles()[p].name));
+    checkGroup(names, [](const NameKey key, std::string_view& outName)
+    {
+        ActionProfile* profile = nullptr;
+        if (!TryGetProfile(key, profile)) return false;
+        outName = profile->GetName();
+        return true;
+    });
+
+    for (uint32_t p = 0; p < image.GetProfileCount(); ++p)
+    {
+        const ProfileImage::ProfileRecord& profileRecord = image.GetProfiles()[p];
+        ActionProfile* profile = nullptr;
+        if (!TryGetProfile(std::string(image.GetString(profileRecord.name)), profile)) profile = nullptr;
+
+        names.clear();
+        for (uint32_t m = profileRecord.firstMap; m < profileRecord.firstMap + profileRecord.mapCount; ++m)
+        {
+            names.push_back(image.GetString(image.GetMaps()[m].name));
+        }
+        checkGroup(names, [profile](const NameKey key, std::string_view& outName)
+        {
+            ActionMap* map = nullptr;
+            if (profile == nullptr || !profile->TryGetMap(key, map)) return false;
+            outName = map->GetName();
+            return true;
+        });
+
+        for (uint32_t m = profileRecord.firstMap; m < profileRecord.firstMap + profileRecord.mapCount; ++m)
+        {
+            const ProfileImage::MapRecord& mapRecord = image.GetMaps()[m];
+            ActionMap* map = nullptr;
+            if (profile == nullptr || !profile->TryGetMap(std::string(image.GetString(mapRecord.name)), map)) map = nullptr;
+
+            names.clear();
+            for (uint32_t a = mapRecord.firstAction; a < mapRecord.firstAction + mapRecord.actionCount; ++a)
+            {
+                names.push_back(image.GetString(image.GetActions()[a].name));
+            }
+            checkGroup(names, [map](const NameKey key, std::string_view& outName)
+            {
+                Action* action = nullptr;
+                if (map == nullptr || !map->TryGetAction(key, action)) return false;
+                outName = action->GetName();
+                return true;
+            });
+
+            // Bindings are re-added by name, which the registry rejects for a repeated name
+            for (uint32_t a = mapRecord.firstAction; a < mapRecord.firstAction + mapRecord.actionCount; ++a)
+            {
+                const ProfileImage::ActionRecord& actionRecord = image.GetActions()[a];
+                names.clear();
+                for (uint32_t b = actionRecord.firstBinding; b < actionRecord.firstBinding + actionRecord.bindingCount; ++b)
+                {
+                    names.push_back(image.GetString(image.GetBindings()[b].name));
+                }
+                std::sort(names.begin(), names.end());
+                const auto repeated = std::adjacent_find(names.begin(), names.end());
+                if (repeated != names.end())
+                {
+                    throw std::runtime_error("Action '" + std::string(image.GetString(actionRecord.name)) + "' has two bindings named '" + std::string(*repeated) + "'");
+                }
+            }
+        }
+    }
+}
+
+void Input::LoadAction(const ProfileImage& image, const uint32_t actionIndex, Action& action)
+{
+    const ProfileImage::ActionRecord& record = image.GetActions()[actionIndex];
+    const ProfileImage::BindingRecord* const bindings = image.GetBindings() + record.firstBinding;
+
+    action.SetTriggerMode(static_cast<Action::TriggerMode>(record.triggerMode));
+    if (record.enabled) action.Enable();
+    else action.Disable();
+
+    uint32_t count = 0;
+    bool isSame = true;
+    for (auto [uuid, name, binding] : action._bindings)
+    {
+        ProfileFormat::BindingRecord current{};
+        isSame = isSame && count < record.bindingCount
+            && name == image.GetString(bindings[count].name)
+            && ProfileCompiler::Describe(binding, current)
+            && ProfileFormat::IsSameBinding(current, bindings[count]);
+        ++count;
+    }
+    if (isSame && count == record.bindingCount) return;
+
+    // Replacing the bindings of a held action would otherwise end it without cancelled
+    const Action::Status status = action.GetStatus();
+    if ((HasAnyFlag(status, Action::Status::Started) || HasAnyFlag(status, Action::Status::Performed))
+        && !HasAnyFlag(status, Action::Status::Cancelled))
+    {
+        InputBindingContext context{};
+        context.activeKeymods = _state.Current().keymods;
+        action.Dispatch(Action::Status::Cancelled, context);
+    }
+
+    action._bindings = InputBindingRegistry{};
+    action._boundKeys.Clear();
+    BindingProgram::MarkStale();
+
+    for (uint32_t b = 0; b < record.bindingCount; ++b)
+    {
+        const ProfileImage::BindingRecord& binding = bindings[b];
+        const std::string name(image.GetString(binding.name));
+        switch (binding.kind)
+        {
+            case ProfileFormat::BindingKind::Button:
+            {
+                const ButtonBinding::Data& data = binding.data.button;
+                action.AddBinding<ButtonBinding>(name, data.scancode, data.keyboardId);
+                break;
+            }
+            case ProfileFormat::BindingKind::Vec2:
+            {
+                const Vec2Binding::Data& data = binding.data.vec2;
+                action.AddBinding<Vec2Binding>(name, data.posXScancode, data.negXScancode,
+                    data.posYScancode, data.negYScancode, data.deadzone, data.keyboardId);
+                break;
+            }
+            case ProfileFormat::BindingKind::MouseButton:
+                action.AddBinding<MouseButtonBinding>(name, binding.data.mouseButton.button);
+                break;
+            case ProfileFormat::BindingKind::MouseDelta:
+                action.AddBinding<MouseDeltaBinding>(name, binding.data.mouseDelta.sensitivity, binding.data.mouseDelta.invertY);
+                break;
+        }
+    }
+}
+
+Input::EventCategory Input::ClassifyEvent(const uint32_t type)
+{
+    // SDL allocates event types in per-subsystem blocks, so a category is a range check
+    if (type >= SDL_EVENT_KEY_DOWN && type < SDL_EVENT_MOUSE_MOTION) return EventCategory::Keyboard;
+    if (type >= SDL_EVENT_MOUSE_MOTION && type <= SDL_EVENT_MOUSE_REMOVED) return EventCategory::Mouse;
+    if (type >= SDL_EVENT_GAMEPAD_AXIS_MOTION && type <= SDL_EVENT_GAMEPAD_STEAM_HANDLE_UPDATED) return EventCategory::Gamepad;
+    return EventCategory::Other;
+}
+
+void Input::ProcessKeyboardEvent(const SDL_Event* const event)
+{
+    switch (event->type)
+    {
+        // Keyboard Events
+        case SDL_EVENT_KEY_DOWN:
+        {
+            SDL_KeyboardID keyboardId = event->key.which;
+            SDL_Scancode scancode = event->key.scancode;
+            _state.RegisterKey(keyboardId, scancode, event->key.timestamp);
+            break;
+        }
+        case SDL_EVENT_KEY_UP:
+        {
+            SDL_KeyboardID keyboardId = event->key.which;
+            SDL_Scancode scancode = event->key.scancode;
+            _state.UnregisterKey(keyboardId, scancode, event->key.timestamp);
+            break;
+        }
+
+        case SDL_EVENT_KEYBOARD_ADDED:
+        {
+            SDL_KeyboardID keyboardId = event->kdevice.which;
+            _state.RegisterKeyboard(keyboardId);
+            break;
+        }
+        case SDL_EVENT_KEYBOARD_REMOVED:
+        {
+            SDL_KeyboardID keyboardId = event->kdevice.which;
+            _state.UnregisterKeyboard(keyboardId, event->kdevice.timestamp);
+            break;
+        }
+        default:
+            break;
+    }
+}
+
+void Input::ProcessMouseEvent(const SDL_Event* const event)
+{
+    switch (event->type)
+    {
+        // Mouse Events
+        case SDL_EVENT_MOUSE_MOTION:
+        {
+            _state.RegisterMouseMotion(event->motion.x, event->motion.y, event->motion.xrel, event->motion.yrel);
+            break;
+        }
+        case SDL_EVENT_MOUSE_BUTTON_DOWN:
+        {
+            _state.RegisterMouseButton(event->button.button, event->button.timestamp);
+            break;
+        }
+        case SDL_EVENT_MOUSE_BUTTON_UP:
+        {
+            _state.UnregisterMouseButton(event->button.button);
+            break;
+        }
+        case SDL_EVENT_MOUSE_WHEEL:
+        {
+            const float direction = event->wheel.direction == SDL_MOUSEWHEEL_FLIPPED ? -1.0f : 1.0f;
+            _state.RegisterMouseWheel(event->wheel.x * direction, event->wheel.y * direction);
+            break;
+        }
+        default:
+            break;
+    }
+}
+
+void Input::ProcessGamepadEvent(const SDL_Event* const event)
+{
+    switch (event->type)
+    {
+        // Gamepad Events
+        case SDL_EVENT_GAMEPAD_AXIS_MOTION:
+        {
+            SDL_JoystickID gamepadId = event->gaxis.which;
+            SDL_GamepadAxis axis = (SDL_GamepadAxis)event->gaxis.axis;
+            // Normalize to -1.0 to 1.0 (or 0.0 to 1.0 if a trigger or similar)
+            float normalizedValue = std::clamp(event->gaxis.value / 32767.0f, -1.0f, 1.0f);
+            _state.RegisterGamepadAxis(gamepadId, axis, normalizedValue);
+            break;
+        }
+        case SDL_EVENT_GAMEPAD_BUTTON_DOWN:
+        {
+            SDL_JoystickID gamepadId = event->gbutton.which;
+            SDL_GamepadButton gamepadButton = (SDL_GamepadButton)event->gbutton.button;
+            _state.RegisterGamepadButton(gamepadId, gamepadButton);
+            break;
+        }
+        case SDL_EVENT_GAMEPAD_BUTTON_UP:
+        {
+            SDL_JoystickID gamepadId = event->gbutton.which;
+            SDL_GamepadButton gamepadButton = (SDL_GamepadButton)event->gbutton.button;
+            _state.UnregisterGamepadButton(gamepadId, gamepadButton);
+            break;
+        }
+        case SDL_EVENT_GAMEPAD_ADDED:
+        {
+            SDL_JoystickID gamepadId = event->gdevice.which;
+            _state.RegisterGamepad(gamepadId);
+            break;
+        }
+        case SDL_EVENT_GAMEPAD_REMOVED:
+        {
+            SDL_JoystickID gamepadId = event->gdevice.which;
+            _state.UnregisterGamepad(gamepadId);
+            break;
+        }
+        case SDL_EVENT_GAMEPAD_TOUCHPAD_DOWN:
+        case SDL_EVENT_GAMEPAD_TOUCHPAD_MOTION:
+        case SDL_EVENT_GAMEPAD_TOUCHPAD_UP:
+        {
+            TouchpadSample sample;
+            sample.timestampNs = event->gtouchpad.timestamp;
+            sample.touchpad = event->gtouchpad.touchpad;
+            sample.finger = event->gtouchpad.finger;
+            sample.x = event->gtouchpad.x;
+            sample.y = event->gtouchpad.y;
+            sample.pressure = event->gtouchpad.pressure;
+            sample.phase = event->type == SDL_EVENT_GAMEPAD_TOUCHPAD_DOWN ? TouchpadPhase::Down
+                : event->type == SDL_EVENT_GAMEPAD_TOUCHPAD_UP ? TouchpadPhase::Up
+                : TouchpadPhase::Motion;
+            _state.RegisterGamepadTouchpad(event->gtouchpad.which, sample);
+            break;
+        }
+        case SDL_EVENT_GAMEPAD_SENSOR_UPDATE:
+        {
+            // Left/right Joy-Con sensors (SDL_SENSOR_*_L / *_R) are not streamed
+            GamepadSensor sensor;
+            if (event->gsensor.sensor == SDL_SENSOR_ACCEL) sensor = GamepadSensor::Accel;
+            else if (event->gsensor.sensor == SDL_SENSOR_GYRO) sensor = GamepadSensor::Gyro;
+            else break;
+
+            SensorSample sample;
+            sample.timestampNs = event->gsensor.timestamp;
+            sample.sensorTimestampNs = event->gsensor.sensor_timestamp;
+            sample.data[0] = event->gsensor.data[0];
+            sample.data[1] = event->gsensor.data[1];
+            sample.data[2] = event->gsensor.data[2];
+            _state.RegisterGamepadSensor(event->gsensor.which, sensor, sample);
+            break;
+        }
+        case SDL_EVENT_GAMEPAD_REMAPPED:             /**< The gamepad mapping was updated */
+        case SDL_EVENT_GAMEPAD_UPDATE_COMPLETE:      /**< Gamepad update is complete */
+        case SDL_EVENT_GAMEPAD_STEAM_HANDLE_UPDATED: /**< Gamepad Steam handle has changed */
+        default:
+            break;
+    }
+}
+
 } // namespace velecs::input
@@ -11,6 +11,7 @@
 #include "velecs/input/InputBindings/ButtonBinding.hpp"
 
 #include "velecs/input/InputPollingState.hpp"
+#include "velecs/input/BindingProgram.hpp"
 
 #include <stdexcept>
 
@@ -24,21 +25,41 @@ namespace velecs::input {
 
 ButtonBinding::Status ButtonBinding::ProcessStatus(const InputPollingState& state, InputBindingContext& outContext) const
 {
-    const bool wasPressed = state.previous.IsKeyDown(_scancode);
-    const bool isPressed = state.current.IsKeyDown(_scancode);
+    return Evaluate(_data, state, outContext);
+}
+
+ButtonBinding::Status ButtonBinding::Evaluate(const Data& data, const InputPollingState& state, InputBindingContext& outContext)
+{
+    const bool isPressed = state.IsKeyPerformed(data.keyboardId, data.scancode);
     
     Status status = Status::Idle;
-    if (!wasPressed  &&  isPressed) status |= Status::Started;
-    if (                 isPressed) status |= Status::Performed;
-    if ( wasPressed  && !isPressed) status |= Status::Cancelled;
+    if (state.IsKeyStarted(data.keyboardId, data.scancode))   status |= Status::Started;
+    if (isPressed)                                            status |= Status::Performed;
+    if (state.IsKeyCancelled(data.keyboardId, data.scancode)) status |= Status::Cancelled;
 
-    outContext.valueType = InputBindingContext::ValueType::Bool;
-    outContext.boolVal = isPressed;
-    outContext.activePrimaryScancode = isPressed ? _scancode : SDL_SCANCODE_UNKNOWN;
+    outContext.SetBool(isPressed);
+    outContext.SetPrimaryScancode(isPressed ? data.scancode : SDL_SCANCODE_UNKNOWN);
+    if (status != Status::Idle)
+    {
+        outContext.SetPressTiming(state.GetKeyPressTimestamp(data.keyboardId, data.scancode), state.GetKeyHoldDuration(data.keyboardId, data.scancode));
+        outContext.SetDeviceId(data.keyboardId);
+    }
 
     return status;
 }
 
+bool ButtonBinding::CollectKeys(KeyBitset& outKeys) const
+{
+    outKeys.Set(_data.scancode);
+    return true;
+}
+
+void ButtonBinding::SetKeyboardId(SDL_KeyboardID keyboardId)
+{
+    _data.keyboardId = keyboardId;
+    BindingProgram::MarkStale();
+}
+
 // Protected Fields
 
 // Protected Methods
@@ -0,0 +1,56 @@
+/// @file    MouseButtonBinding.cpp
+/// @author  Matthew Green
+/// @date    2026-10-15 14:38:02
+///
+/// @section LICENSE
+///
+/// Copyright (c) 2026 Matthew Green - All rights reserved
+/// Unauthorized copying of this file, via any medium is strictly prohibited
+/// Proprietary and confidential
+
+#include "velecs/input/InputBindings/MouseButtonBinding.hpp"
+
+#include "velecs/input/InputPollingState.hpp"
+
+namespace velecs::input {
+
+// Public Fields
+
+// Constructors and Destructors
+
+// Public Methods
+
+MouseButtonBinding::Status MouseButtonBinding::ProcessStatus(const InputPollingState& state, InputBindingContext& outContext) const
+{
+    return Evaluate(_data, state, outContext);
+}
+
+MouseButtonBinding::Status MouseButtonBinding::Evaluate(const Data& data, const InputPollingState& state, InputBindingContext& outContext)
+{
+    const bool isPressed = state.IsMouseButtonPerformed(data.button);
+
+    Status status = Status::Idle;
+    if (state.IsMouseButtonStarted(data.button))   status |= Status::Started;
+    if (isPressed)                                 status |= Status::Performed;
+    if (state.IsMouseButtonCancelled(data.button)) status |= Status::Cancelled;
+
+    outContext.SetBool(isPressed);
+    if (isPressed)
+    {
+        const uint64_t pressTimestamp = state.GetMouseButtonPressTimestamp(data.button);
+        const uint64_t frameTimestamp = state.GetFrameTimestamp();
+        outContext.SetPressTiming(pressTimestamp, frameTimestamp > pressTimestamp ? frameTimestamp - pressTimestamp : 0);
+    }
+
+    return status;
+}
+
+// Protected Fields
+
+// Protected Methods
+
+// Private Fields
+
+// Private Methods
+
+} // namespace velecs::input
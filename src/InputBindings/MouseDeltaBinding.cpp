@@ -0,0 +1,64 @@
+/// @file    MouseDeltaBinding.cpp
+/// @author  Matthew Green
+/// @date    2026-10-15 14:52:13
+///
+/// @section LICENSE
+///
+/// Copyright (c) 2026 Matthew Green - All rights reserved
+/// Unauthorized copying of this file, via any medium is strictly prohibited
+/// Proprietary and confidential
+
+#include "velecs/input/InputBindings/MouseDeltaBinding.hpp"
+
+#include "velecs/input/InputPollingState.hpp"
+#include "velecs/input/BindingProgram.hpp"
+
+using namespace velecs::math;
+
+namespace velecs::input {
+
+// Public Fields
+
+// Constructors and Destructors
+
+// Public Methods
+
+MouseDeltaBinding::Status MouseDeltaBinding::ProcessStatus(const InputPollingState& state, InputBindingContext& outContext) const
+{
+    return Evaluate(_data, state, outContext);
+}
+
+MouseDeltaBinding::Status MouseDeltaBinding::Evaluate(const Data& data, const InputPollingState& state, InputBindingContext& outContext)
+{
+    const PollingData& previous = state.Previous();
+    const PollingData& current = state.Current();
+
+    const bool wasMoving = previous.mouseDeltaX != 0.0f || previous.mouseDeltaY != 0.0f;
+    const bool isMoving = current.mouseDeltaX != 0.0f || current.mouseDeltaY != 0.0f;
+
+    Status status = Status::Idle;
+    if (!wasMoving  &&  isMoving) status |= Status::Started;
+    if (                isMoving) status |= Status::Performed;
+    if ( wasMoving  && !isMoving) status |= Status::Cancelled;
+
+    const float ySign = data.invertY ? -1.0f : 1.0f;
+    outContext.SetVec2(Vec2{current.mouseDeltaX * data.sensitivity, current.mouseDeltaY * data.sensitivity * ySign});
+
+    return status;
+}
+
+void MouseDeltaBinding::SetSensitivity(float sensitivity)
+{
+    _data.sensitivity = sensitivity;
+    BindingProgram::MarkStale();
+}
+
+// Protected Fields
+
+// Protected Methods
+
+// Private Fields
+
+// Private Methods
+
+} // namespace velecs::input
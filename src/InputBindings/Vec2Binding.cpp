@@ -11,6 +11,7 @@
 #include "velecs/input/InputBindings/Vec2Binding.hpp"
 
 #include "velecs/input/InputPollingState.hpp"
+#include "velecs/input/BindingProgram.hpp"
 
 using namespace velecs::math;
 
@@ -24,30 +25,47 @@ namespace velecs::input {
 
 Vec2Binding::Status Vec2Binding::ProcessStatus(const InputPollingState& state, InputBindingContext& outContext) const
 {
-    const Vec2 prev = CalculateVec2(state.previous);
-    const Vec2 curr = CalculateVec2(state.current);
+    return Evaluate(_data, state, outContext);
+}
+
+Vec2Binding::Status Vec2Binding::Evaluate(const Data& data, const InputPollingState& state, InputBindingContext& outContext)
+{
+    const int keyboardSlot = state.GetKeyboardSlot(data.keyboardId);
+    const KeyBitset& currentKeys = state.Current().GetKeyboardKeys(keyboardSlot);
+    const Vec2 curr = CalculateVec2(data, currentKeys);
 
-    const bool wasPastDeadzone = prev.LInfNorm() > _deadzone;
-    const bool isPastDeadzone = curr.LInfNorm() > _deadzone;
+    // The previous vector can only differ if one of the four keys changed this frame
+    const bool keysChanged = state.IsKeyChanged(data.keyboardId, data.posXScancode) || state.IsKeyChanged(data.keyboardId, data.negXScancode)
+                          || state.IsKeyChanged(data.keyboardId, data.posYScancode) || state.IsKeyChanged(data.keyboardId, data.negYScancode);
+    const Vec2 prev = keysChanged ? CalculateVec2(data, state.Previous().GetKeyboardKeys(keyboardSlot)) : curr;
+
+    const bool wasPastDeadzone = prev.LInfNorm() > data.deadzone;
+    const bool isPastDeadzone = curr.LInfNorm() > data.deadzone;
 
     Status status = Status::Idle;
     if (!wasPastDeadzone  &&  isPastDeadzone) status |= Status::Started;
     if (                      isPastDeadzone) status |= Status::Performed;
     if ( wasPastDeadzone  && !isPastDeadzone) status |= Status::Cancelled;
 
-    outContext.valueType = InputBindingContext::ValueType::Vec2;
-    outContext.vec2Val = curr;
-    if (isPastDeadzone)
-    {
-        if (state.current.IsKeyDown(_posXScancode)) outContext.activePrimaryScancode = _posXScancode;
-        else if (state.current.IsKeyDown(_negXScancode)) outContext.activePrimaryScancode = _negXScancode;
-
-        if (state.current.IsKeyDown(_posYScancode)) outContext.activeSecondaryScancode = _posYScancode;
-        else if (state.current.IsKeyDown(_negYScancode)) outContext.activeSecondaryScancode = _negYScancode;
-    }
+    FillContext(data, state, currentKeys, curr, isPastDeadzone, outContext);
     return status;
 }
 
+bool Vec2Binding::CollectKeys(KeyBitset& outKeys) const
+{
+    outKeys.Set(_data.posXScancode);
+    outKeys.Set(_data.negXScancode);
+    outKeys.Set(_data.posYScancode);
+    outKeys.Set(_data.negYScancode);
+    return true;
+}
+
+void Vec2Binding::SetKeyboardId(SDL_KeyboardID keyboardId)
+{
+    _data.keyboardId = keyboardId;
+    BindingProgram::MarkStale();
+}
+
 // Protected Fields
 
 // Protected Methods
@@ -56,14 +74,43 @@ Vec2Binding::Status Vec2Binding::ProcessStatus(const InputPollingState& state, I
 
 // Private Methods
 
-Vec2 Vec2Binding::CalculateVec2(const PollingData& data) const
+void Vec2Binding::FillContext(const Data& data, const InputPollingState& state, const KeyBitset& currentKeys, const Vec2& value, const bool isPastDeadzone, InputBindingContext& outContext)
+{
+    outContext.SetVec2(value);
+    if (isPastDeadzone)
+    {
+        if (currentKeys.Test(data.posXScancode)) outContext.SetPrimaryScancode(data.posXScancode);
+        else if (currentKeys.Test(data.negXScancode)) outContext.SetPrimaryScancode(data.negXScancode);
+
+        if (currentKeys.Test(data.posYScancode)) outContext.SetSecondaryScancode(data.posYScancode);
+        else if (currentKeys.Test(data.negYScancode)) outContext.SetSecondaryScancode(data.negYScancode);
+
+        // Report the earliest press among the active keys so the hold covers the whole gesture
+        uint64_t pressTimestamp = UINT64_MAX;
+        for (const SDL_Scancode scancode : {outContext.GetPrimaryScancode(), outContext.GetSecondaryScancode()})
+        {
+            if (scancode == SDL_SCANCODE_UNKNOWN) continue;
+            const uint64_t timestamp = state.GetKeyPressTimestamp(data.keyboardId, scancode);
+            if (timestamp < pressTimestamp) pressTimestamp = timestamp;
+        }
+
+        if (pressTimestamp != UINT64_MAX)
+        {
+            const uint64_t frameTimestamp = state.GetFrameTimestamp();
+            outContext.SetPressTiming(pressTimestamp, frameTimestamp > pressTimestamp ? frameTimestamp - pressTimestamp : 0);
+        }
+        outContext.SetDeviceId(data.keyboardId);
+    }
+}
+
+Vec2 Vec2Binding::CalculateVec2(const Data& data, const KeyBitset& keys)
 {
     return Vec2{
-          (data.IsKeyDown(_posXScancode) ?  1.0f : 0.0f)
-        + (data.IsKeyDown(_negXScancode) ? -1.0f : 0.0f),
+          (keys.Test(data.posXScancode) ?  1.0f : 0.0f)
+        + (keys.Test(data.negXScancode) ? -1.0f : 0.0f),
 
-          (data.IsKeyDown(_posYScancode) ?  1.0f : 0.0f)
-        + (data.IsKeyDown(_negYScancode) ? -1.0f : 0.0f)
+          (keys.Test(data.posYScancode) ?  1.0f : 0.0f)
+        + (keys.Test(data.negYScancode) ? -1.0f : 0.0f)
     };
 }
 
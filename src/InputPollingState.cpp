@@ -10,6 +10,9 @@
 
 #include "velecs/input/InputPollingState.hpp"
 
+#include <cmath>
+#include <cstring>
+
 namespace velecs::input {
 
 // Public Fields
@@ -18,33 +21,426 @@ namespace velecs::input {
 
 // Public Methods
 
+void InputPollingState::RegisterKey(const SDL_Scancode scancode, const uint64_t timestampNs)
+{
+    ApplyKey(DeviceSlotMap<PollingData::MAX_KEYBOARDS>::INVALID_SLOT, scancode, true, timestampNs);
+}
+
+void InputPollingState::UnregisterKey(const SDL_Scancode scancode, const uint64_t timestampNs)
+{
+    ApplyKey(DeviceSlotMap<PollingData::MAX_KEYBOARDS>::INVALID_SLOT, scancode, false, timestampNs);
+}
+
+void InputPollingState::RegisterKey(const SDL_KeyboardID keyboardId, const SDL_Scancode scancode, const uint64_t timestampNs)
+{
+    const int slot = _keyboards.Add(keyboardId);
+
+    // Late events from a keyboard already disconnected must not press keys in the freed slot
+    if (IsKeyboardSlotRemoved(slot)) return;
+
+    ApplyKey(slot, scancode, true, timestampNs);
+}
+
+void InputPollingState::UnregisterKey(const SDL_KeyboardID keyboardId, const SDL_Scancode scancode, const uint64_t timestampNs)
+{
+    ApplyKey(_keyboards.Find(keyboardId), scancode, false, timestampNs);
+}
+
+int InputPollingState::RegisterKeyboard(const SDL_KeyboardID keyboardId)
+{
+    const int slot = _keyboards.Add(keyboardId);
+    return IsKeyboardSlotRemoved(slot) ? DeviceSlotMap<PollingData::MAX_KEYBOARDS>::INVALID_SLOT : slot;
+}
+
+void InputPollingState::UnregisterKeyboard(const SDL_KeyboardID keyboardId, const uint64_t timestampNs)
+{
+    const int slot = _keyboards.Find(keyboardId);
+    if (slot == DeviceSlotMap<PollingData::MAX_KEYBOARDS>::INVALID_SLOT) return;
+
+    // Release through the normal path so the merged state, journal and edges stay consistent
+    const KeyBitset heldKeys = Current().keyboardKeys[slot];
+    for (const SDL_Scancode scancode : heldKeys)
+    {
+        ApplyKey(slot, scancode, false, timestampNs);
+    }
+
+    _removedKeyboardSlots |= uint32_t{1} << slot;
+}
+
+int InputPollingState::RegisterGamepad(const SDL_JoystickID gamepadId)
+{
+    const bool isNew = _gamepads.Find(gamepadId) == DeviceSlotMap<PollingData::MAX_GAMEPADS>::INVALID_SLOT;
+    const int slot = _gamepads.Add(gamepadId);
+    if (slot == DeviceSlotMap<PollingData::MAX_GAMEPADS>::INVALID_SLOT) return slot;
+
+    // Late events from a gamepad already disconnected must not refill the slot before it is freed
+    if ((_removedGamepadSlots & (uint32_t{1} << slot)) != 0) return DeviceSlotMap<PollingData::MAX_GAMEPADS>::INVALID_SLOT;
+    if (!isNew) return slot;
+
+    // A reused slot may still hold values from the previous occupant
+    PollingData& current = _frames[_currentIndex];
+    current.gamepadButtons[slot] = 0;
+    for (float& value : current.gamepadAxes[slot]) value = 0.0f;
+    _gamepadStreams[slot].Reset();
+    return slot;
+}
+
+void InputPollingState::UnregisterGamepad(const SDL_JoystickID gamepadId)
+{
+    const int slot = _gamepads.Find(gamepadId);
+    if (slot == DeviceSlotMap<PollingData::MAX_GAMEPADS>::INVALID_SLOT) return;
+
+    ResetStaleTransitions();
+
+    PollingData& current = _frames[_currentIndex];
+    _gamepadReleasedButtons[slot] |= current.gamepadButtons[slot];
+    current.gamepadButtons[slot] = 0;
+    for (float& value : current.gamepadAxes[slot]) value = 0.0f;
+
+    _removedGamepadSlots |= uint32_t{1} << slot;
+}
+
+void InputPollingState::RegisterGamepadButton(const SDL_JoystickID gamepadId, const SDL_GamepadButton button)
+{
+    ApplyGamepadButton(RegisterGamepad(gamepadId), button, true);
+}
+
+void InputPollingState::UnregisterGamepadButton(const SDL_JoystickID gamepadId, const SDL_GamepadButton button)
+{
+    ApplyGamepadButton(_gamepads.Find(gamepadId), button, false);
+}
+
+void InputPollingState::RegisterGamepadAxis(const SDL_JoystickID gamepadId, const SDL_GamepadAxis axis, const float value)
+{
+    if (axis < 0 || axis >= SDL_GAMEPAD_AXIS_COUNT) return;
+
+    const int slot = RegisterGamepad(gamepadId);
+    if (slot == DeviceSlotMap<PollingData::MAX_GAMEPADS>::INVALID_SLOT) return;
+
+    _frames[_currentIndex].gamepadAxes[slot][axis] = value;
+}
+
+void InputPollingState::RegisterGamepadSensor(const SDL_JoystickID gamepadId, const GamepadSensor sensor, const SensorSample& sample)
+{
+    if (sensor >= GamepadSensor::Count) return;
+
+    const int slot = RegisterGamepad(gamepadId);
+    if (slot == DeviceSlotMap<PollingData::MAX_GAMEPADS>::INVALID_SLOT) return;
+
+    _gamepadStreams[slot].sensors[static_cast<std::size_t>(sensor)].Push(sample);
+}
+
+void InputPollingState::RegisterGamepadTouchpad(const SDL_JoystickID gamepadId, const TouchpadSample& sample)
+{
+    const int slot = RegisterGamepad(gamepadId);
+    if (slot == DeviceSlotMap<PollingData::MAX_GAMEPADS>::INVALID_SLOT) return;
+
+    _gamepadStreams[slot].touchpad.Push(sample);
+}
+
+void InputPollingState::RegisterMouseButton(const uint8_t button, const uint64_t timestampNs)
+{
+    if (button == 0 || button > 32) return;
+
+    ResetStaleTransitions();
+
+    uint32_t& buttons = _frames[_currentIndex].mouseButtons;
+    const uint32_t bit = SDL_BUTTON_MASK(button);
+    if ((buttons & bit) != 0) return;
+
+    buttons |= bit;
+    _mousePressedButtons |= bit;
+    _mouseButtonPressTimestamps[button - 1] = timestampNs;
+}
+
+void InputPollingState::UnregisterMouseButton(const uint8_t button)
+{
+    if (button == 0 || button > 32) return;
+
+    ResetStaleTransitions();
+
+    uint32_t& buttons = _frames[_currentIndex].mouseButtons;
+    const uint32_t bit = SDL_BUTTON_MASK(button);
+    if ((buttons & bit) == 0) return;
+
+    buttons &= ~bit;
+    _mouseReleasedButtons |= bit;
+}
+
+void InputPollingState::UpdateEdges()
+{
+    ResetStaleTransitions();
+
+    for (GamepadStreams& streams : _gamepadStreams) streams.Latch();
+
+    const PollingData& previous = Previous();
+    const PollingData& current = Current();
+    for (std::size_t slot = 0; slot < PollingData::MAX_GAMEPADS; ++slot)
+    {
+        const uint32_t bounced = _gamepadPressedButtons[slot] & _gamepadReleasedButtons[slot];
+        _gamepadStartedButtons[slot] = (current.gamepadButtons[slot] & ~previous.gamepadButtons[slot]) | bounced;
+        _gamepadCancelledButtons[slot] = (previous.gamepadButtons[slot] & ~current.gamepadButtons[slot]) | bounced;
+    }
+
+    const uint32_t mouseBounced = _mousePressedButtons & _mouseReleasedButtons;
+    _mouseStartedButtons = (current.mouseButtons & ~previous.mouseButtons) | mouseBounced;
+    _mouseCancelledButtons = (previous.mouseButtons & ~current.mouseButtons) | mouseBounced;
+
+    KeyBitset::ComputeEdges(
+        Previous().downKeys,
+        Current().downKeys,
+        _pressedKeys,
+        _releasedKeys,
+        _startedKeys,
+        _cancelledKeys
+    );
+}
+
 void InputPollingState::ShiftFrame()
 {
-    // Copy current state to previous (preserves current for persistent key tracking)
-    previous = current;
+    // Swap buffers so the frame that just finished becomes previous
+    _currentIndex ^= 1u;
+
+    PollingData& current = _frames[_currentIndex];
+    const PollingData& previous = _frames[_currentIndex ^ 1u];
+
+    if (_changedKeysOverflowed)
+    {
+        // Too many changes to replay individually, fall back to a plain copy
+        current = previous;
+    }
+    else
+    {
+        // The new current buffer is two frames old, so only the journaled keys differ
+        for (std::size_t i = 0; i < _changedKeyCount; ++i)
+        {
+            const KeyChange& change = _changedKeys[i];
+            current.downKeys.Assign(change.scancode, previous.downKeys.Test(change.scancode));
+            if (change.keyboardSlot >= 0)
+            {
+                const KeyBitset& previousKeys = previous.keyboardKeys[change.keyboardSlot];
+                current.keyboardKeys[change.keyboardSlot].Assign(change.scancode, previousKeys.Test(change.scancode));
+            }
+        }
+        current.keymods = previous.keymods;
+
+        // Gamepad state is small and changes constantly, so it is copied wholesale
+        std::memcpy(current.gamepadButtons, previous.gamepadButtons, sizeof(current.gamepadButtons));
+        std::memcpy(current.gamepadAxes, previous.gamepadAxes, sizeof(current.gamepadAxes));
+
+        current.mouseButtons = previous.mouseButtons;
+        current.mouseX = previous.mouseX;
+        current.mouseY = previous.mouseY;
+    }
+
+    // Relative motion and wheel are per-frame sums, so the new frame starts from zero
+    current.mouseDeltaX = 0.0f;
+    current.mouseDeltaY = 0.0f;
+    current.mouseWheelX = 0.0f;
+    current.mouseWheelY = 0.0f;
+
+    // Disconnected devices keep their slot through the frame they were removed in, so
+    // their cancelled edges were readable by id
+    while (_removedKeyboardSlots != 0)
+    {
+        const int slot = static_cast<int>(KeyBitset::CountTrailingZeros(_removedKeyboardSlots));
+        _removedKeyboardSlots &= _removedKeyboardSlots - 1;
+        _keyboards.Remove(_keyboards.GetId(slot));
+    }
+    while (_removedGamepadSlots != 0)
+    {
+        const int slot = static_cast<int>(KeyBitset::CountTrailingZeros(_removedGamepadSlots));
+        _removedGamepadSlots &= _removedGamepadSlots - 1;
+        _gamepads.Remove(_gamepads.GetId(slot));
+    }
+
+    // Counters stay readable until the next frame's first event
+    _transitionsStale = true;
 }
 
 bool InputPollingState::IsKeyStarted(const SDL_Scancode scancode) const
 {
     // Key just started: wasn't pressed last frame, is pressed this frame
-    bool wasPressed = previous.IsKeyDown(scancode);
-    bool isPressed = current.IsKeyDown(scancode);
-    return !wasPressed && isPressed;
+    return _startedKeys.Test(scancode);
 }
 
 bool InputPollingState::IsKeyPerformed(const SDL_Scancode scancode) const
 {
     // Key is being performed: currently pressed this frame
-    bool isPressed = current.IsKeyDown(scancode);
+    bool isPressed = Current().IsKeyDown(scancode);
     return isPressed;
 }
 
 bool InputPollingState::IsKeyCancelled(const SDL_Scancode scancode) const
 {
     // Key was cancelled: was pressed last frame, not pressed this frame
-    bool wasPressed = previous.IsKeyDown(scancode);
-    bool isPressed = current.IsKeyDown(scancode);
-    return wasPressed && !isPressed;
+    return _cancelledKeys.Test(scancode);
+}
+
+bool InputPollingState::IsKeyStarted(const SDL_KeyboardID keyboardId, const SDL_Scancode scancode) const
+{
+    if (keyboardId == ANY_KEYBOARD) return IsKeyStarted(scancode);
+
+    const int slot = _keyboards.Find(keyboardId);
+    if (slot == DeviceSlotMap<PollingData::MAX_KEYBOARDS>::INVALID_SLOT) return false;
+
+    const bool wasPressed = Previous().keyboardKeys[slot].Test(scancode);
+    const bool isPressed = Current().keyboardKeys[slot].Test(scancode);
+    const bool isBounced = _keyboardPressedKeys[slot].Test(scancode) && _keyboardReleasedKeys[slot].Test(scancode);
+    return (!wasPressed && isPressed) || isBounced;
+}
+
+bool InputPollingState::IsKeyPerformed(const SDL_KeyboardID keyboardId, const SDL_Scancode scancode) const
+{
+    return Current().GetKeyboardKeys(GetKeyboardSlot(keyboardId)).Test(scancode);
+}
+
+bool InputPollingState::IsKeyCancelled(const SDL_KeyboardID keyboardId, const SDL_Scancode scancode) const
+{
+    if (keyboardId == ANY_KEYBOARD) return IsKeyCancelled(scancode);
+
+    const int slot = _keyboards.Find(keyboardId);
+    if (slot == DeviceSlotMap<PollingData::MAX_KEYBOARDS>::INVALID_SLOT) return false;
+
+    const bool wasPressed = Previous().keyboardKeys[slot].Test(scancode);
+    const bool isPressed = Current().keyboardKeys[slot].Test(scancode);
+    const bool isBounced = _keyboardPressedKeys[slot].Test(scancode) && _keyboardReleasedKeys[slot].Test(scancode);
+    return (wasPressed && !isPressed) || isBounced;
+}
+
+bool InputPollingState::IsKeyChanged(const SDL_KeyboardID keyboardId, const SDL_Scancode scancode) const
+{
+    return IsKeyStarted(keyboardId, scancode) || IsKeyCancelled(keyboardId, scancode);
+}
+
+bool InputPollingState::IsGamepadButtonStarted(const SDL_JoystickID gamepadId, const SDL_GamepadButton button) const
+{
+    return TestGamepadMask(_gamepadStartedButtons, gamepadId, button);
+}
+
+bool InputPollingState::IsGamepadButtonPerformed(const SDL_JoystickID gamepadId, const SDL_GamepadButton button) const
+{
+    return TestGamepadMask(Current().gamepadButtons, gamepadId, button);
+}
+
+bool InputPollingState::IsGamepadButtonCancelled(const SDL_JoystickID gamepadId, const SDL_GamepadButton button) const
+{
+    return TestGamepadMask(_gamepadCancelledButtons, gamepadId, button);
+}
+
+float InputPollingState::GetGamepadAxis(const SDL_JoystickID gamepadId, const SDL_GamepadAxis axis) const
+{
+    const PollingData& current = Current();
+    if (gamepadId != ANY_GAMEPAD) return current.GetGamepadAxis(_gamepads.Find(gamepadId), axis);
+
+    float result = 0.0f;
+    const uint32_t activeMask = _gamepads.GetActiveMask();
+    for (std::size_t slot = 0; slot < PollingData::MAX_GAMEPADS; ++slot)
+    {
+        if ((activeMask & (uint32_t{1} << slot)) == 0) continue;
+        const float value = current.GetGamepadAxis(static_cast<int>(slot), axis);
+        if (std::fabs(value) > std::fabs(result)) result = value;
+    }
+    return result;
+}
+
+bool InputPollingState::IsMouseButtonStarted(const uint8_t button) const
+{
+    if (button == 0 || button > 32) return false;
+    return (_mouseStartedButtons & SDL_BUTTON_MASK(button)) != 0;
+}
+
+bool InputPollingState::IsMouseButtonPerformed(const uint8_t button) const
+{
+    return Current().IsMouseButtonDown(button);
+}
+
+bool InputPollingState::IsMouseButtonCancelled(const uint8_t button) const
+{
+    if (button == 0 || button > 32) return false;
+    return (_mouseCancelledButtons & SDL_BUTTON_MASK(button)) != 0;
+}
+
+uint64_t InputPollingState::GetMouseButtonPressTimestamp(const uint8_t button) const
+{
+    if (button == 0 || button > 32) return 0;
+    return _mouseButtonPressTimestamps[button - 1];
+}
+
+SampleSpan<SensorSample> InputPollingState::GetGamepadSensorSamples(const SDL_JoystickID gamepadId, const GamepadSensor sensor) const
+{
+    if (sensor >= GamepadSensor::Count) return {};
+
+    const int slot = GetGamepadStreamSlot(gamepadId);
+    if (slot == DeviceSlotMap<PollingData::MAX_GAMEPADS>::INVALID_SLOT) return {};
+
+    return _gamepadStreams[slot].sensors[static_cast<std::size_t>(sensor)].GetFrameSamples();
+}
+
+SampleSpan<TouchpadSample> InputPollingState::GetGamepadTouchpadSamples(const SDL_JoystickID gamepadId) const
+{
+    const int slot = GetGamepadStreamSlot(gamepadId);
+    if (slot == DeviceSlotMap<PollingData::MAX_GAMEPADS>::INVALID_SLOT) return {};
+
+    return _gamepadStreams[slot].touchpad.GetFrameSamples();
+}
+
+uint64_t InputPollingState::GetKeyPressTimestamp(const SDL_Scancode scancode) const
+{
+    const std::size_t index = static_cast<std::size_t>(scancode);
+    return index < KeyBitset::BIT_COUNT ? _keyPressTimestamps[index] : 0;
+}
+
+uint64_t InputPollingState::GetKeyHoldDuration(const SDL_Scancode scancode) const
+{
+    const std::size_t index = static_cast<std::size_t>(scancode);
+    if (index >= KeyBitset::BIT_COUNT) return 0;
+
+    uint64_t end = 0;
+    if (Current().IsKeyDown(scancode)) end = _frameTimestampNs;
+    else if (_cancelledKeys.Test(scancode)) end = _keyReleaseTimestamps[index];
+
+    const uint64_t start = _keyPressTimestamps[index];
+    return end > start ? end - start : 0;
+}
+
+uint64_t InputPollingState::GetKeyPressTimestamp(const SDL_KeyboardID keyboardId, const SDL_Scancode scancode) const
+{
+    if (keyboardId == ANY_KEYBOARD) return GetKeyPressTimestamp(scancode);
+
+    const std::size_t index = static_cast<std::size_t>(scancode);
+    const int slot = _keyboards.Find(keyboardId);
+    if (index >= KeyBitset::BIT_COUNT || slot == DeviceSlotMap<PollingData::MAX_KEYBOARDS>::INVALID_SLOT) return 0;
+
+    return _keyboardPressTimestamps[slot][index];
+}
+
+uint64_t InputPollingState::GetKeyHoldDuration(const SDL_KeyboardID keyboardId, const SDL_Scancode scancode) const
+{
+    if (keyboardId == ANY_KEYBOARD) return GetKeyHoldDuration(scancode);
+
+    const std::size_t index = static_cast<std::size_t>(scancode);
+    const int slot = _keyboards.Find(keyboardId);
+    if (index >= KeyBitset::BIT_COUNT || slot == DeviceSlotMap<PollingData::MAX_KEYBOARDS>::INVALID_SLOT) return 0;
+
+    uint64_t end = 0;
+    if (Current().keyboardKeys[slot].Test(scancode)) end = _frameTimestampNs;
+    else if (IsKeyCancelled(keyboardId, scancode)) end = _keyboardReleaseTimestamps[slot][index];
+
+    const uint64_t start = _keyboardPressTimestamps[slot][index];
+    return end > start ? end - start : 0;
+}
+
+uint8_t InputPollingState::GetKeyPressCount(const SDL_Scancode scancode) const
+{
+    const std::size_t index = static_cast<std::size_t>(scancode);
+    return index < KeyBitset::BIT_COUNT ? _keyPressCounts[index] : 0;
+}
+
+uint8_t InputPollingState::GetKeyReleaseCount(const SDL_Scancode scancode) const
+{
+    const std::size_t index = static_cast<std::size_t>(scancode);
+    return index < KeyBitset::BIT_COUNT ? _keyReleaseCounts[index] : 0;
 }
 
 // Protected Fields
@@ -55,4 +451,172 @@ bool InputPollingState::IsKeyCancelled(const SDL_Scancode scancode) const
 
 // Private Methods
 
+void InputPollingState::JournalKey(const SDL_Scancode scancode, const int keyboardSlot)
+{
+    if (_changedKeyCount < MAX_CHANGED_KEYS)
+    {
+        _changedKeys[_changedKeyCount++] = KeyChange{scancode, static_cast<int8_t>(keyboardSlot)};
+    }
+    else
+    {
+        _changedKeysOverflowed = true;
+    }
+}
+
+void InputPollingState::ResetStaleTransitions()
+{
+    if (!_transitionsStale) return;
+
+    if (_changedKeysOverflowed)
+    {
+        std::memset(_keyPressCounts, 0, sizeof(_keyPressCounts));
+        std::memset(_keyReleaseCounts, 0, sizeof(_keyReleaseCounts));
+    }
+    else
+    {
+        for (std::size_t i = 0; i < _changedKeyCount; ++i)
+        {
+            const std::size_t index = static_cast<std::size_t>(_changedKeys[i].scancode);
+            if (index >= KeyBitset::BIT_COUNT) continue;
+            _keyPressCounts[index] = 0;
+            _keyReleaseCounts[index] = 0;
+        }
+    }
+
+    _pressedKeys.Clear();
+    _releasedKeys.Clear();
+    _releasedFirstKeys.Clear();
+    for (std::size_t slot = 0; slot < PollingData::MAX_KEYBOARDS; ++slot)
+    {
+        _keyboardPressedKeys[slot].Clear();
+        _keyboardReleasedKeys[slot].Clear();
+    }
+    std::memset(_gamepadPressedButtons, 0, sizeof(_gamepadPressedButtons));
+    std::memset(_gamepadReleasedButtons, 0, sizeof(_gamepadReleasedButtons));
+    _mousePressedButtons = 0;
+    _mouseReleasedButtons = 0;
+
+    _changedKeyCount = 0;
+    _changedKeysOverflowed = false;
+    _transitionsStale = false;
+}
+
+void InputPollingState::ApplyKey(const int keyboardSlot, const SDL_Scancode scancode, const bool isDown, const uint64_t timestampNs)
+{
+    if (static_cast<std::size_t>(scancode) >= KeyBitset::BIT_COUNT) return;
+
+    ResetStaleTransitions();
+
+    PollingData& current = _frames[_currentIndex];
+
+    // Per-keyboard state, skipped for unknown keyboards or when every slot is taken
+    bool isSlotChanged = false;
+    if (keyboardSlot >= 0)
+    {
+        KeyBitset& keys = current.keyboardKeys[keyboardSlot];
+        if (keys.Test(scancode) != isDown)
+        {
+            keys.Assign(scancode, isDown);
+            if (isDown)
+            {
+                _keyboardPressedKeys[keyboardSlot].Set(scancode);
+                _keyboardPressTimestamps[keyboardSlot][scancode] = timestampNs;
+            }
+            else
+            {
+                _keyboardReleasedKeys[keyboardSlot].Set(scancode);
+                _keyboardReleaseTimestamps[keyboardSlot][scancode] = timestampNs;
+            }
+            isSlotChanged = true;
+        }
+    }
+
+    // Merged state stays down while any other keyboard still holds the key
+    const bool isMergedDown = isDown || IsKeyHeldElsewhere(scancode, keyboardSlot);
+    const bool isMergedChanged = current.downKeys.Test(scancode) != isMergedDown;
+
+    if (!isSlotChanged && !isMergedChanged) return;
+    JournalKey(scancode, isSlotChanged ? keyboardSlot : DeviceSlotMap<PollingData::MAX_KEYBOARDS>::INVALID_SLOT);
+    if (!isMergedChanged) return;
+
+    const std::size_t index = static_cast<std::size_t>(scancode);
+    current.downKeys.Assign(scancode, isMergedDown);
+    if (isMergedDown)
+    {
+        if (_keyPressCounts[index] < UINT8_MAX) ++_keyPressCounts[index];
+        _keyPressTimestamps[index] = timestampNs;
+        _pressedKeys.Set(scancode);
+    }
+    else
+    {
+        if (!_pressedKeys.Test(scancode) && !_releasedKeys.Test(scancode)) _releasedFirstKeys.Set(scancode);
+        if (_keyReleaseCounts[index] < UINT8_MAX) ++_keyReleaseCounts[index];
+        _keyReleaseTimestamps[index] = timestampNs;
+        _releasedKeys.Set(scancode);
+    }
+}
+
+bool InputPollingState::IsKeyHeldElsewhere(const SDL_Scancode scancode, const int exceptSlot) const
+{
+    const PollingData& current = Current();
+    const uint32_t activeMask = _keyboards.GetActiveMask();
+    for (std::size_t slot = 0; slot < PollingData::MAX_KEYBOARDS; ++slot)
+    {
+        if (static_cast<int>(slot) == exceptSlot) continue;
+        if ((activeMask & (uint32_t{1} << slot)) == 0) continue;
+        if (current.keyboardKeys[slot].Test(scancode)) return true;
+    }
+    return false;
+}
+
+void InputPollingState::ApplyGamepadButton(const int gamepadSlot, const SDL_GamepadButton button, const bool isDown)
+{
+    if (gamepadSlot == DeviceSlotMap<PollingData::MAX_GAMEPADS>::INVALID_SLOT) return;
+    if (button < 0 || button >= SDL_GAMEPAD_BUTTON_COUNT) return;
+
+    ResetStaleTransitions();
+
+    uint32_t& buttons = _frames[_currentIndex].gamepadButtons[gamepadSlot];
+    const uint32_t bit = uint32_t{1} << button;
+    if (((buttons & bit) != 0) == isDown) return;
+
+    if (isDown)
+    {
+        buttons |= bit;
+        _gamepadPressedButtons[gamepadSlot] |= bit;
+    }
+    else
+    {
+        buttons &= ~bit;
+        _gamepadReleasedButtons[gamepadSlot] |= bit;
+    }
+}
+
+bool InputPollingState::TestGamepadMask(const uint32_t (&masks)[PollingData::MAX_GAMEPADS], const SDL_JoystickID gamepadId, const SDL_GamepadButton button) const
+{
+    if (button < 0 || button >= SDL_GAMEPAD_BUTTON_COUNT) return false;
+    const uint32_t bit = uint32_t{1} << button;
+
+    if (gamepadId != ANY_GAMEPAD)
+    {
+        const int slot = _gamepads.Find(gamepadId);
+        if (slot == DeviceSlotMap<PollingData::MAX_GAMEPADS>::INVALID_SLOT) return false;
+        return (masks[slot] & bit) != 0;
+    }
+
+    uint32_t combined = 0;
+    for (std::size_t slot = 0; slot < PollingData::MAX_GAMEPADS; ++slot) combined |= masks[slot];
+    return (combined & bit) != 0;
+}
+
+int InputPollingState::GetGamepadStreamSlot(const SDL_JoystickID gamepadId) const
+{
+    if (gamepadId != ANY_GAMEPAD) return _gamepads.Find(gamepadId);
+
+    // Samples from different pads cannot be merged into one span, so "any" means the first pad
+    const uint32_t activeMask = _gamepads.GetActiveMask();
+    if (activeMask == 0) return DeviceSlotMap<PollingData::MAX_GAMEPADS>::INVALID_SLOT;
+    return static_cast<int>(KeyBitset::CountTrailingZeros(activeMask));
+}
+
 } // namespace velecs::input
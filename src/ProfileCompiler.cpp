@@ -0,0 +1,461 @@
+/// @file    ProfileCompiler.cpp
+/// @author  Matthew Green
+/// @date    2026-10-15 19:44:37
+///
+/// @section LICENSE
+///
+/// Copyright (c) 2026 Matthew Green - All rights reserved
+/// Unauthorized copying of this file, via any medium is strictly prohibited
+/// Proprietary and confidential
+
+#include "velecs/input/ProfileCompiler.hpp"
+
+#include "velecs/input/ActionProfile.hpp"
+
+#include <SDL3/SDL.h>
+
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+
+namespace velecs::input {
+
+// Public Fields
+
+// Constructors and Destructors
+
+// Public Methods
+
+void ProfileCompiler::AddProfile(const std::string_view name, const bool enabled)
+{
+    ProfileFormat::ProfileRecord record{};
+    record.name = AddString(name);
+    record.firstMap = static_cast<uint32_t>(_maps.size());
+    record.enabled = enabled;
+    _profiles.push_back(record);
+}
+
+void ProfileCompiler::AddMap(const std::string_view name, const int32_t priority,
+    const ActionMap::InputConsumption consumption, const bool enabled)
+{
+    if (_profiles.empty()) throw std::runtime_error("Map '" + std::string(name) + "' is not inside a profile");
+
+    ProfileFormat::MapRecord record{};
+    record.name = AddString(name);
+    record.firstAction = static_cast<uint32_t>(_actions.size());
+    record.priority = priority;
+    record.inputConsumption = static_cast<uint8_t>(consumption);
+    record.enabled = enabled;
+    _maps.push_back(record);
+    ++_profiles.back().mapCount;
+}
+
+void ProfileCompiler::AddAction(const std::string_view name, const Action::TriggerMode triggerMode, const bool enabled)
+{
+    if (_maps.empty()) throw std::runtime_error("Action '" + std::string(name) + "' is not inside a map");
+
+    ProfileFormat::ActionRecord record{};
+    record.name = AddString(name);
+    record.firstBinding = static_cast<uint32_t>(_bindings.size());
+    record.triggerMode = static_cast<uint8_t>(triggerMode);
+    record.enabled = enabled;
+    _actions.push_back(record);
+    ++_maps.back().actionCount;
+}
+
+void ProfileCompiler::AddBinding(const std::string_view name, const ButtonBinding::Data& data)
+{
+    AddBindingRecord(name, ProfileFormat::BindingKind::Button).data.button = data;
+}
+
+void ProfileCompiler::AddBinding(const std::string_view name, const Vec2Binding::Data& data)
+{
+    AddBindingRecord(name, ProfileFormat::BindingKind::Vec2).data.vec2 = data;
+}
+
+void ProfileCompiler::AddBinding(const std::string_view name, const MouseButtonBinding::Data& data)
+{
+    AddBindingRecord(name, ProfileFormat::BindingKind::MouseButton).data.mouseButton = data;
+}
+
+void ProfileCompiler::AddBinding(const std::string_view name, const MouseDeltaBinding::Data& data)
+{
+    // Field by field, copying the struct would also copy its indeterminate padding
+    // bytes and make the output differ between identical inputs
+    MouseDeltaBinding::Data& stored = AddBindingRecord(name, ProfileFormat::BindingKind::MouseDelta).data.mouseDelta;
+    stored.sensitivity = data.sensitivity;
+    stored.invertY = data.invertY;
+}
+
+void ProfileCompiler::AddBinding(const std::string_view name, const ProfileFormat::BindingRecord& record)
+{
+    switch (record.kind)
+    {
+        case ProfileFormat::BindingKind::Button:      AddBinding(name, record.data.button); break;
+        case ProfileFormat::BindingKind::Vec2:        AddBinding(name, record.data.vec2); break;
+        case ProfileFormat::BindingKind::MouseButton: AddBinding(name, record.data.mouseButton); break;
+        case ProfileFormat::BindingKind::MouseDelta:  AddBinding(name, record.data.mouseDelta); break;
+    }
+}
+
+std::vector<uint8_t> ProfileCompiler::Finish() const
+{
+    ProfileFormat::Header header{};
+    header.magic = ProfileFormat::MAGIC;
+    header.version = ProfileFormat::VERSION;
+    header.headerSize = sizeof(ProfileFormat::Header);
+    header.profileCount = static_cast<uint32_t>(_profiles.size());
+    header.mapCount = static_cast<uint32_t>(_maps.size());
+    header.actionCount = static_cast<uint32_t>(_actions.size());
+    header.bindingCount = static_cast<uint32_t>(_bindings.size());
+    header.stringBytes = static_cast<uint32_t>(_strings.size());
+
+    std::vector<uint8_t> bytes;
+    bytes.reserve(sizeof(header)
+        + _profiles.size() * sizeof(ProfileFormat::ProfileRecord)
+        + _maps.size() * sizeof(ProfileFormat::MapRecord)
+        + _actions.size() * sizeof(ProfileFormat::ActionRecord)
+        + _bindings.size() * sizeof(ProfileFormat::BindingRecord)
+        + _strings.size());
+
+    const auto append = [&bytes](const void* data, const std::size_t size)
+    {
+        const uint8_t* const begin = static_cast<const uint8_t*>(data);
+        bytes.insert(bytes.end(), begin, begin + size);
+    };
+    append(&header, sizeof(header));
+    append(_profiles.data(), _profiles.size() * sizeof(ProfileFormat::ProfileRecord));
+    append(_maps.data(), _maps.size() * sizeof(ProfileFormat::MapRecord));
+    append(_actions.data(), _actions.size() * sizeof(ProfileFormat::ActionRecord));
+    append(_bindings.data(), _bindings.size() * sizeof(ProfileFormat::BindingRecord));
+    append(_strings.data(), _strings.size());
+    return bytes;
+}
+
+std::vector<uint8_t> ProfileCompiler::CompileText(const std::string_view source)
+{
+    ProfileCompiler compiler;
+
+    std::size_t lineNumber = 0;
+    std::size_t lineStart = 0;
+    while (lineStart <= source.size())
+    {
+        std::size_t lineEnd = source.find('\n', lineStart);
+        if (lineEnd == std::string_view::npos) lineEnd = source.size();
+        ++lineNumber;
+
+        std::string_view line = source.substr(lineStart, lineEnd - lineStart);
+        if (!line.empty() && line.back() == '\r') line.remove_suffix(1);
+
+        try
+        {
+            compiler.CompileLine(Tokenize(line));
+        }
+        catch (const std::runtime_error& error)
+        {
+            throw std::runtime_error("Line " + std::to_string(lineNumber) + ": " + error.what());
+        }
+
+        lineStart = lineEnd + 1;
+    }
+
+    return compiler.Finish();
+}
+
+std::vector<uint8_t> ProfileCompiler::Serialize(ActionProfileRegistry& profiles)
+{
+    ProfileCompiler compiler;
+
+    for (auto [name, uuid, profile] : profiles)
+    {
+        compiler.AddProfile(profile.GetName(), profile.IsEnabled());
+
+        // Registry order, the loaded profile sorts its own stack from the priorities
+        for (auto [mapUuid, mapName, map] : profile._maps)
+        {
+            compiler.AddMap(map.GetName(), map.GetPriority(), map.GetInputConsumption(), map.IsEnabled());
+
+            for (auto [actionUuid, actionName, action] : map._actions)
+            {
+                compiler.AddAction(action.GetName(), action.GetTriggerMode(), action.IsEnabled());
+
+                for (auto [bindingUuid, bindingName, binding] : action._bindings)
+                {
+                    ProfileFormat::BindingRecord record{};
+                    if (!Describe(binding, record))
+                    {
+                        throw std::runtime_error("Binding '" + bindingName + "' is not a built-in type and has no binary form");
+                    }
+                    compiler.AddBinding(bindingName, record);
+                }
+            }
+        }
+    }
+
+    return compiler.Finish();
+}
+
+bool ProfileCompiler::Describe(const InputBinding& binding, ProfileFormat::BindingRecord& outRecord)
+{
+    if (const auto* button = dynamic_cast<const ButtonBinding*>(&binding))
+    {
+        outRecord.kind = ProfileFormat::BindingKind::Button;
+        outRecord.data.button = button->GetData();
+        return true;
+    }
+    if (const auto* vec2 = dynamic_cast<const Vec2Binding*>(&binding))
+    {
+        outRecord.kind = ProfileFormat::BindingKind::Vec2;
+        outRecord.data.vec2 = vec2->GetData();
+        return true;
+    }
+    if (const auto* mouseButton = dynamic_cast<const MouseButtonBinding*>(&binding))
+    {
+        outRecord.kind = ProfileFormat::BindingKind::MouseButton;
+        outRecord.data.mouseButton = mouseButton->GetData();
+        return true;
+    }
+    if (const auto* mouseDelta = dynamic_cast<const MouseDeltaBinding*>(&binding))
+    {
+        outRecord.kind = ProfileFormat::BindingKind::MouseDelta;
+        outRecord.data.mouseDelta.sensitivity = mouseDelta->GetData().sensitivity;
+        outRecord.data.mouseDelta.invertY = mouseDelta->GetData().invertY;
+        return true;
+    }
+    return false;
+}
+
+void ProfileCompiler::WriteFile(const std::string& path, const std::vector<uint8_t>& bytes)
+{
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    if (!file) throw std::runtime_error("Failed to open '" + path + "' for writing");
+
+    file.write(reinterpret_cast<const char*>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+    if (!file) throw std::runtime_error("Failed to write '" + path + "'");
+}
+
+// Protected Fields
+
+// Protected Methods
+
+// Private Fields
+
+// Private Methods
+
+ProfileFormat::StringRef ProfileCompiler::AddString(const std::string_view name)
+{
+    const ProfileFormat::StringRef ref{static_cast<uint32_t>(_strings.size()), static_cast<uint32_t>(name.size())};
+    _strings.append(name.data(), name.size());
+    return ref;
+}
+
+ProfileFormat::BindingRecord& ProfileCompiler::AddBindingRecord(const std::string_view name, const ProfileFormat::BindingKind kind)
+{
+    if (_actions.empty()) throw std::runtime_error("Binding '" + std::string(name) + "' is not inside an action");
+
+    ProfileFormat::BindingRecord record{};
+    record.name = AddString(name);
+    record.kind = kind;
+    _bindings.push_back(record);
+    ++_actions.back().bindingCount;
+    return _bindings.back();
+}
+
+void ProfileCompiler::CompileLine(const std::vector<std::string>& tokens)
+{
+    if (tokens.empty()) return;
+
+    const std::string& keyword = tokens[0];
+    if (tokens.size() < 2) throw std::runtime_error("'" + keyword + "' needs a name");
+    const std::string& name = tokens[1];
+
+    // Positional arguments come first, then key=value options and bare flags
+    std::vector<std::string> arguments;
+    std::vector<std::pair<std::string, std::string>> options;
+    for (std::size_t i = 2; i < tokens.size(); ++i)
+    {
+        const std::size_t equals = tokens[i].find('=');
+        if (equals == std::string::npos && options.empty()) arguments.push_back(tokens[i]);
+        else if (equals == std::string::npos) options.emplace_back(tokens[i], "");
+        else options.emplace_back(tokens[i].substr(0, equals), tokens[i].substr(equals + 1));
+    }
+
+    const auto toFloat = [](const std::string& text)
+    {
+        char* end = nullptr;
+        const float value = std::strtof(text.c_str(), &end);
+        if (text.empty() || *end != '\0') throw std::runtime_error("'" + text + "' is not a number");
+        return value;
+    };
+    const auto toInt = [](const std::string& text)
+    {
+        char* end = nullptr;
+        const long value = std::strtol(text.c_str(), &end, 10);
+        if (text.empty() || *end != '\0') throw std::runtime_error("'" + text + "' is not an integer");
+        return value;
+    };
+    const auto toBool = [](const std::string& text)
+    {
+        if (text == "true" || text.empty()) return true;
+        if (text == "false") return false;
+        throw std::runtime_error("'" + text + "' is not true or false");
+    };
+    const auto toScancode = [](const std::string& text)
+    {
+        const SDL_Scancode scancode = SDL_GetScancodeFromName(text.c_str());
+        if (scancode == SDL_SCANCODE_UNKNOWN) throw std::runtime_error("'" + text + "' is not a scancode name");
+        return scancode;
+    };
+    const auto expectArguments = [&keyword, &arguments](const std::size_t count)
+    {
+        if (arguments.size() != count)
+        {
+            throw std::runtime_error("'" + keyword + "' takes " + std::to_string(count) + " arguments after its name");
+        }
+    };
+    const auto unknownOption = [&keyword](const std::string& option)
+    {
+        return std::runtime_error("'" + keyword + "' has no option '" + option + "'");
+    };
+
+    bool enabled = true;
+    if (keyword == "profile")
+    {
+        expectArguments(0);
+        for (const auto& [key, value] : options)
+        {
+            if (key == "enabled") enabled = toBool(value);
+            else throw unknownOption(key);
+        }
+        AddProfile(name, enabled);
+    }
+    else if (keyword == "map")
+    {
+        expectArguments(0);
+        int32_t priority = 0;
+        ActionMap::InputConsumption consumption = ActionMap::InputConsumption::None;
+        for (const auto& [key, value] : options)
+        {
+            if (key == "enabled") enabled = toBool(value);
+            else if (key == "priority") priority = static_cast<int32_t>(toInt(value));
+            else if (key == "consume" && value == "none") consumption = ActionMap::InputConsumption::None;
+            else if (key == "consume" && value == "keys") consumption = ActionMap::InputConsumption::BoundKeys;
+            else if (key == "consume" && value == "all") consumption = ActionMap::InputConsumption::All;
+            else if (key == "consume") throw std::runtime_error("'" + value + "' is not none, keys or all");
+            else throw unknownOption(key);
+        }
+        AddMap(name, priority, consumption, enabled);
+    }
+    else if (keyword == "action")
+    {
+        expectArguments(0);
+        Action::TriggerMode triggerMode = Action::TriggerMode::Continuous;
+        for (const auto& [key, value] : options)
+        {
+            if (key == "enabled") enabled = toBool(value);
+            else if (key == "trigger" && value == "continuous") triggerMode = Action::TriggerMode::Continuous;
+            else if (key == "trigger" && value == "changed") triggerMode = Action::TriggerMode::ValueChanged;
+            else if (key == "trigger") throw std::runtime_error("'" + value + "' is not continuous or changed");
+            else throw unknownOption(key);
+        }
+        AddAction(name, triggerMode, enabled);
+    }
+    else if (keyword == "button")
+    {
+        expectArguments(1);
+        ButtonBinding::Data data{toScancode(arguments[0]), 0};
+        for (const auto& [key, value] : options)
+        {
+            if (key == "keyboard") data.keyboardId = static_cast<SDL_KeyboardID>(toInt(value));
+            else throw unknownOption(key);
+        }
+        AddBinding(name, data);
+    }
+    else if (keyword == "vec2")
+    {
+        expectArguments(4);
+        Vec2Binding::Data data{toScancode(arguments[0]), toScancode(arguments[1]),
+            toScancode(arguments[2]), toScancode(arguments[3]), 0.0f, 0};
+        for (const auto& [key, value] : options)
+        {
+            if (key == "deadzone") data.deadzone = toFloat(value);
+            else if (key == "keyboard") data.keyboardId = static_cast<SDL_KeyboardID>(toInt(value));
+            else throw unknownOption(key);
+        }
+        AddBinding(name, data);
+    }
+    else if (keyword == "mousebutton")
+    {
+        expectArguments(1);
+        const std::string& button = arguments[0];
+        MouseButtonBinding::Data data{};
+        if (button == "left") data.button = SDL_BUTTON_LEFT;
+        else if (button == "middle") data.button = SDL_BUTTON_MIDDLE;
+        else if (button == "right") data.button = SDL_BUTTON_RIGHT;
+        else if (button == "x1") data.button = SDL_BUTTON_X1;
+        else if (button == "x2") data.button = SDL_BUTTON_X2;
+        else data.button = static_cast<uint8_t>(toInt(button));
+        if (!options.empty()) throw unknownOption(options.front().first);
+        AddBinding(name, data);
+    }
+    else if (keyword == "mousedelta")
+    {
+        expectArguments(0);
+        MouseDeltaBinding::Data data{1.0f, false};
+        for (const auto& [key, value] : options)
+        {
+            if (key == "sensitivity") data.sensitivity = toFloat(value);
+            else if (key == "inverty") data.invertY = toBool(value);
+            else throw unknownOption(key);
+        }
+        AddBinding(name, data);
+    }
+    else
+    {
+        throw std::runtime_error("Unknown declaration '" + keyword + "'");
+    }
+}
+
+std::vector<std::string> ProfileCompiler::Tokenize(const std::string_view line)
+{
+    std::vector<std::string> tokens;
+
+    std::size_t i = 0;
+    while (i < line.size())
+    {
+        const char c = line[i];
+        if (c == ' ' || c == '\t') { ++i; continue; }
+        if (c == '#') break;
+
+        std::string token;
+        if (c == '"')
+        {
+            const std::size_t close = line.find('"', i + 1);
+            if (close == std::string_view::npos) throw std::runtime_error("Unterminated quote");
+            token.assign(line.substr(i + 1, close - i - 1));
+            i = close + 1;
+        }
+        else
+        {
+            // Quotes may also open mid-token, as in name="Left Stick"
+            while (i < line.size() && line[i] != ' ' && line[i] != '\t' && line[i] != '#')
+            {
+                if (line[i] == '"')
+                {
+                    const std::size_t close = line.find('"', i + 1);
+                    if (close == std::string_view::npos) throw std::runtime_error("Unterminated quote");
+                    token.append(line.substr(i + 1, close - i - 1));
+                    i = close + 1;
+                    continue;
+                }
+                token.push_back(line[i++]);
+            }
+        }
+        tokens.push_back(std::move(token));
+    }
+
+    return tokens;
+}
+
+} // namespace velecs::input
@@ -0,0 +1,255 @@
+/// @file    ProfileImage.cpp
+/// @author  Matthew Green
+/// @date    2026-10-15 19:15:22
+///
+/// @section LICENSE
+///
+/// Copyright (c) 2026 Matthew Green - All rights reserved
+/// Unauthorized copying of this file, via any medium is strictly prohibited
+/// Proprietary and confidential
+
+#include "velecs/input/ProfileImage.hpp"
+
+#include "velecs/input/ActionMap.hpp"
+#include "velecs/input/Action.hpp"
+
+#include <cstring>
+#include <stdexcept>
+#include <utility>
+
+#ifdef _WIN32
+    #ifndef WIN32_LEAN_AND_MEAN
+        #define WIN32_LEAN_AND_MEAN
+    #endif
+    #ifndef NOMINMAX
+        #define NOMINMAX
+    #endif
+    #include <windows.h>
+#else
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+namespace velecs::input {
+
+// Public Fields
+
+// Constructors and Destructors
+
+ProfileImage::ProfileImage(std::vector<uint8_t> bytes)
+    : _buffer(std::move(bytes))
+{
+    _data = _buffer.data();
+    _size = _buffer.size();
+    Validate();
+}
+
+ProfileImage::ProfileImage(ProfileImage&& other) noexcept
+{
+    *this = std::move(other);
+}
+
+ProfileImage& ProfileImage::operator=(ProfileImage&& other) noexcept
+{
+    if (this == &other) return *this;
+
+    Reset();
+
+    // Moving the vector keeps its storage, so every record pointer stays valid
+    _data = other._data;
+    _size = other._size;
+    _buffer = std::move(other._buffer);
+    _isMapped = other._isMapped;
+    _profiles = other._profiles;
+    _maps = other._maps;
+    _actions = other._actions;
+    _bindings = other._bindings;
+    _strings = other._strings;
+
+    other._data = nullptr;
+    other._size = 0;
+    other._isMapped = false;
+    other.Reset();
+    return *this;
+}
+
+ProfileImage::~ProfileImage()
+{
+    Reset();
+}
+
+// Public Methods
+
+ProfileImage ProfileImage::MapFile(const std::string& path)
+{
+    ProfileImage image;
+
+#ifdef _WIN32
+    const HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE) throw std::runtime_error("Failed to open profile file '" + path + "'");
+
+    LARGE_INTEGER size{};
+    if (!GetFileSizeEx(file, &size) || size.QuadPart < static_cast<LONGLONG>(sizeof(Header)))
+    {
+        CloseHandle(file);
+        throw std::runtime_error("Profile file '" + path + "' is too small");
+    }
+
+    const HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    const void* view = mapping != nullptr ? MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0) : nullptr;
+
+    // The view keeps the file mapped on its own
+    if (mapping != nullptr) CloseHandle(mapping);
+    CloseHandle(file);
+    if (view == nullptr) throw std::runtime_error("Failed to map profile file '" + path + "'");
+
+    image._size = static_cast<std::size_t>(size.QuadPart);
+#else
+    const int file = open(path.c_str(), O_RDONLY);
+    if (file < 0) throw std::runtime_error("Failed to open profile file '" + path + "'");
+
+    struct stat info{};
+    if (fstat(file, &info) != 0 || info.st_size < static_cast<off_t>(sizeof(Header)))
+    {
+        close(file);
+        throw std::runtime_error("Profile file '" + path + "' is too small");
+    }
+
+    void* view = mmap(nullptr, static_cast<std::size_t>(info.st_size), PROT_READ, MAP_PRIVATE, file, 0);
+
+    // The mapping keeps the file referenced on its own
+    close(file);
+    if (view == MAP_FAILED) throw std::runtime_error("Failed to map profile file '" + path + "'");
+
+    image._size = static_cast<std::size_t>(info.st_size);
+#endif
+
+    image._data = static_cast<const uint8_t*>(view);
+    image._isMapped = true;
+    image.Validate();
+    return image;
+}
+
+// Protected Fields
+
+// Protected Methods
+
+// Private Fields
+
+// Private Methods
+
+void ProfileImage::Validate()
+{
+    if (_size < sizeof(Header)) throw std::runtime_error("Profile image is too small for its header");
+
+    const Header& header = GetHeader();
+    if (header.magic != ProfileFormat::MAGIC) throw std::runtime_error("Profile image has the wrong magic or byte order");
+    if (header.version != ProfileFormat::VERSION) throw std::runtime_error("Profile image version " + std::to_string(header.version) + " is not supported");
+    if (header.headerSize != sizeof(Header)) throw std::runtime_error("Profile image has an unexpected header size");
+
+    // 64-bit sums cannot overflow for 32-bit counts
+    const uint64_t profilesOffset = sizeof(Header);
+    const uint64_t mapsOffset = profilesOffset + uint64_t{header.profileCount} * sizeof(ProfileRecord);
+    const uint64_t actionsOffset = mapsOffset + uint64_t{header.mapCount} * sizeof(MapRecord);
+    const uint64_t bindingsOffset = actionsOffset + uint64_t{header.actionCount} * sizeof(ActionRecord);
+    const uint64_t stringsOffset = bindingsOffset + uint64_t{header.bindingCount} * sizeof(BindingRecord);
+    if (stringsOffset + header.stringBytes > _size) throw std::runtime_error("Profile image is truncated");
+
+    _profiles = reinterpret_cast<const ProfileRecord*>(_data + profilesOffset);
+    _maps = reinterpret_cast<const MapRecord*>(_data + mapsOffset);
+    _actions = reinterpret_cast<const ActionRecord*>(_data + actionsOffset);
+    _bindings = reinterpret_cast<const BindingRecord*>(_data + bindingsOffset);
+    _strings = reinterpret_cast<const char*>(_data + stringsOffset);
+
+    const auto checkString = [&header](const ProfileFormat::StringRef ref)
+    {
+        if (uint64_t{ref.offset} + ref.length > header.stringBytes) throw std::runtime_error("Profile image has a name outside its string pool");
+    };
+    const auto checkRange = [](const uint32_t first, const uint32_t count, const uint32_t total)
+    {
+        if (uint64_t{first} + count > total) throw std::runtime_error("Profile image has a child range outside its record array");
+    };
+    const auto checkScancode = [](const SDL_Scancode scancode)
+    {
+        if (scancode < 0 || scancode >= SDL_SCANCODE_COUNT) throw std::runtime_error("Profile image has an invalid scancode");
+    };
+
+    for (uint32_t i = 0; i < header.profileCount; ++i)
+    {
+        checkString(_profiles[i].name);
+        checkRange(_profiles[i].firstMap, _profiles[i].mapCount, header.mapCount);
+    }
+    for (uint32_t i = 0; i < header.mapCount; ++i)
+    {
+        checkString(_maps[i].name);
+        checkRange(_maps[i].firstAction, _maps[i].actionCount, header.actionCount);
+        if (_maps[i].inputConsumption > static_cast<uint8_t>(ActionMap::InputConsumption::All))
+        {
+            throw std::runtime_error("Profile image has an invalid input consumption");
+        }
+    }
+    for (uint32_t i = 0; i < header.actionCount; ++i)
+    {
+        checkString(_actions[i].name);
+        checkRange(_actions[i].firstBinding, _actions[i].bindingCount, header.bindingCount);
+        if (_actions[i].triggerMode > static_cast<uint8_t>(Action::TriggerMode::ValueChanged))
+        {
+            throw std::runtime_error("Profile image has an invalid trigger mode");
+        }
+    }
+    for (uint32_t i = 0; i < header.bindingCount; ++i)
+    {
+        const BindingRecord& binding = _bindings[i];
+        checkString(binding.name);
+        switch (binding.kind)
+        {
+            case ProfileFormat::BindingKind::Button:
+                checkScancode(binding.data.button.scancode);
+                break;
+            case ProfileFormat::BindingKind::Vec2:
+                checkScancode(binding.data.vec2.posXScancode);
+                checkScancode(binding.data.vec2.negXScancode);
+                checkScancode(binding.data.vec2.posYScancode);
+                checkScancode(binding.data.vec2.negYScancode);
+                break;
+            case ProfileFormat::BindingKind::MouseButton:
+                break;
+            case ProfileFormat::BindingKind::MouseDelta:
+            {
+                // Any other byte in a bool is undefined behaviour, so read it as a raw byte
+                uint8_t invertY = 0;
+                std::memcpy(&invertY, &binding.data.mouseDelta.invertY, sizeof(invertY));
+                if (invertY > 1) throw std::runtime_error("Profile image has an invalid inverty flag");
+                break;
+            }
+            default:
+                throw std::runtime_error("Profile image has an unknown binding kind");
+        }
+    }
+}
+
+void ProfileImage::Reset()
+{
+    if (_isMapped && _data != nullptr)
+    {
+#ifdef _WIN32
+        UnmapViewOfFile(_data);
+#else
+        munmap(const_cast<uint8_t*>(_data), _size);
+#endif
+    }
+
+    _data = nullptr;
+    _size = 0;
+    _buffer.clear();
+    _isMapped = false;
+    _profiles = nullptr;
+    _maps = nullptr;
+    _actions = nullptr;
+    _bindings = nullptr;
+    _strings = nullptr;
+}
+
+} // namespace velecs::input
@@ -0,0 +1,235 @@
+/// @file    ProfileWatcher.cpp
+/// @author  Matthew Green
+/// @date    2026-10-15 20:26:31
+///
+/// @section LICENSE
+///
+/// Copyright (c) 2026 Matthew Green - All rights reserved
+/// Unauthorized copying of this file, via any medium is strictly prohibited
+/// Proprietary and confidential
+
+#include "velecs/input/ProfileWatcher.hpp"
+
+#include "velecs/input/ProfileCompiler.hpp"
+
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+#include <string_view>
+#include <vector>
+
+#ifdef __linux__
+    #include <cerrno>
+    #include <fcntl.h>
+    #include <poll.h>
+    #include <sys/inotify.h>
+    #include <unistd.h>
+#endif
+
+namespace velecs::input {
+
+// Public Fields
+
+// Constructors and Destructors
+
+ProfileWatcher::ProfileWatcher(const std::string& path, const std::chrono::milliseconds pollInterval)
+    : _path(path), _pollInterval(pollInterval)
+{
+#ifdef __linux__
+    // Watch the directory rather than the file, editors often save by replacing the file
+    std::filesystem::path directory = std::filesystem::path(_path).parent_path();
+    if (directory.empty()) directory = ".";
+
+    _inotifyFd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    const bool isWatching = _inotifyFd >= 0
+        && inotify_add_watch(_inotifyFd, directory.c_str(), IN_CLOSE_WRITE | IN_MOVED_TO | IN_CREATE) >= 0
+        && pipe2(_wakePipe, O_CLOEXEC) == 0;
+    if (!isWatching)
+    {
+        if (_inotifyFd >= 0) close(_inotifyFd);
+        _inotifyFd = -1;
+    }
+#endif
+
+    _thread = std::thread(&ProfileWatcher::Run, this);
+}
+
+ProfileWatcher::~ProfileWatcher()
+{
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _isRunning.store(false);
+    }
+    _stopSignal.notify_all();
+
+#ifdef __linux__
+    if (_wakePipe[1] >= 0)
+    {
+        const char wake = 1;
+        (void)write(_wakePipe[1], &wake, 1);
+    }
+#endif
+
+    if (_thread.joinable()) _thread.join();
+
+#ifdef __linux__
+    if (_inotifyFd >= 0) close(_inotifyFd);
+    if (_wakePipe[0] >= 0) close(_wakePipe[0]);
+    if (_wakePipe[1] >= 0) close(_wakePipe[1]);
+#endif
+}
+
+// Public Methods
+
+bool ProfileWatcher::TryTakeImage(std::unique_ptr<ProfileImage>& outImage)
+{
+    if (!_hasPending.load(std::memory_order_acquire)) return false;
+
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (_pending == nullptr) return false;
+
+    outImage = std::move(_pending);
+    _hasPending.store(false, std::memory_order_relaxed);
+    return true;
+}
+
+std::string ProfileWatcher::GetLastError() const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _lastError;
+}
+
+void ProfileWatcher::ReportError(const std::string& error)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    _lastError = error;
+}
+
+ProfileImage ProfileWatcher::Compile(const std::string& path)
+{
+    // Read into memory rather than mapping, the file may be rewritten while it is loaded
+    std::ifstream file(path, std::ios::binary);
+    if (!file) throw std::runtime_error("Failed to open profile file '" + path + "'");
+
+    std::vector<uint8_t> bytes((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    if (file.bad()) throw std::runtime_error("Failed to read profile file '" + path + "'");
+
+    uint32_t magic = 0;
+    if (bytes.size() >= sizeof(magic)) std::memcpy(&magic, bytes.data(), sizeof(magic));
+    if (magic == ProfileFormat::MAGIC) return ProfileImage(std::move(bytes));
+
+    const std::string_view source(reinterpret_cast<const char*>(bytes.data()), bytes.size());
+    return ProfileImage(ProfileCompiler::CompileText(source));
+}
+
+// Protected Fields
+
+// Protected Methods
+
+// Private Fields
+
+// Private Methods
+
+void ProfileWatcher::Run()
+{
+#ifdef __linux__
+    if (WatchWithNotifications()) return;
+#endif
+    WatchWithPolling();
+}
+
+void ProfileWatcher::Reload()
+{
+    try
+    {
+        auto image = std::make_unique<ProfileImage>(Compile(_path));
+
+        std::lock_guard<std::mutex> lock(_mutex);
+        _pending = std::move(image);
+        _lastError.clear();
+        _hasPending.store(true, std::memory_order_release);
+        _reloadCount.fetch_add(1, std::memory_order_relaxed);
+    }
+    catch (const std::exception& error)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _lastError = error.what();
+    }
+}
+
+bool ProfileWatcher::WatchWithNotifications()
+{
+#ifdef __linux__
+    if (_inotifyFd < 0) return false;
+
+    const std::string fileName = std::filesystem::path(_path).filename().string();
+    alignas(inotify_event) char buffer[4096];
+    bool isDirty = false;
+
+    while (_isRunning.load())
+    {
+        pollfd fds[2] = {{_inotifyFd, POLLIN, 0}, {_wakePipe[0], POLLIN, 0}};
+
+        // Once the file has changed, only wait for it to go quiet before compiling
+        const int timeoutMs = isDirty ? static_cast<int>(SETTLE_DELAY.count()) : -1;
+        const int ready = poll(fds, 2, timeoutMs);
+        if (ready < 0)
+        {
+            if (errno == EINTR) continue;
+            return false;
+        }
+        if (fds[1].revents != 0) break;
+        if (ready == 0)
+        {
+            isDirty = false;
+            Reload();
+            continue;
+        }
+
+        ssize_t length = 0;
+        while ((length = read(_inotifyFd, buffer, sizeof(buffer))) > 0)
+        {
+            for (ssize_t offset = 0; offset < length; )
+            {
+                const inotify_event* const event = reinterpret_cast<const inotify_event*>(buffer + offset);
+                if (event->len != 0 && fileName == event->name) isDirty = true;
+                offset += static_cast<ssize_t>(sizeof(inotify_event) + event->len);
+            }
+        }
+    }
+    return true;
+#else
+    return false;
+#endif
+}
+
+void ProfileWatcher::WatchWithPolling()
+{
+    std::error_code error;
+    std::filesystem::file_time_type lastWriteTime = std::filesystem::last_write_time(_path, error);
+    std::uintmax_t lastSize = std::filesystem::file_size(_path, error);
+
+    while (true)
+    {
+        {
+            std::unique_lock<std::mutex> lock(_mutex);
+            _stopSignal.wait_for(lock, _pollInterval, [this] { return !_isRunning.load(); });
+            if (!_isRunning.load()) return;
+        }
+
+        // A file that is missing mid-save is simply checked again next interval
+        const std::filesystem::file_time_type writeTime = std::filesystem::last_write_time(_path, error);
+        if (error) continue;
+        const std::uintmax_t size = std::filesystem::file_size(_path, error);
+        if (error) continue;
+        if (writeTime == lastWriteTime && size == lastSize) continue;
+
+        lastWriteTime = writeTime;
+        lastSize = size;
+        Reload();
+    }
+}
+
+} // namespace velecs::input
@@ -0,0 +1,260 @@
+/// @file    Vec2CompositeBatch.cpp
+/// @author  Matthew Green
+/// @date    2026-10-15 16:19:05
+///
+/// @section LICENSE
+///
+/// Copyright (c) 2026 Matthew Green - All rights reserved
+/// Unauthorized copying of this file, via any medium is strictly prohibited
+/// Proprietary and confidential
+
+#include "velecs/input/Vec2CompositeBatch.hpp"
+
+#include "velecs/input/InputPollingState.hpp"
+
+using namespace velecs::math;
+
+namespace velecs::input {
+
+// Public Fields
+
+// Constructors and Destructors
+
+// Public Methods
+
+void Vec2CompositeBatch::Clear()
+{
+    _count = 0;
+
+    _posXScancodes.clear();
+    _negXScancodes.clear();
+    _posYScancodes.clear();
+    _negYScancodes.clear();
+    _deadzones.clear();
+    _keyboardIds.clear();
+
+    for (auto* lanes : {&_posX, &_negX, &_posY, &_negY, &_valueX, &_valueY})
+    {
+        lanes->clear();
+    }
+    _statuses.clear();
+    _pastDeadzoneMasks.clear();
+    _isSeeded = false;
+
+    _keyCompositeOffsets.clear();
+    _keyComposites.clear();
+    _isIndexed = false;
+    _computedGroups.clear();
+    _groupStamps.clear();
+}
+
+uint32_t Vec2CompositeBatch::Add(const Vec2Binding::Data& data)
+{
+    const uint32_t index = static_cast<uint32_t>(_count++);
+
+    // Padding lanes read SDL_SCANCODE_UNKNOWN, which is never down, and their results are never read
+    const std::size_t padded = (_count + LANES - 1) / LANES * LANES;
+    _posXScancodes.resize(padded, SDL_SCANCODE_UNKNOWN);
+    _negXScancodes.resize(padded, SDL_SCANCODE_UNKNOWN);
+    _posYScancodes.resize(padded, SDL_SCANCODE_UNKNOWN);
+    _negYScancodes.resize(padded, SDL_SCANCODE_UNKNOWN);
+    _deadzones.resize(padded, 0.0f);
+    _keyboardIds.resize(padded, 0);
+
+    for (auto* lanes : {&_posX, &_negX, &_posY, &_negY, &_valueX, &_valueY})
+    {
+        lanes->resize(padded, 0.0f);
+    }
+    _statuses.resize(padded, InputStatus::Idle);
+    _pastDeadzoneMasks.resize(padded / LANES, 0);
+    _groupStamps.resize(padded / LANES, 0);
+    _isSeeded = false;
+    _isIndexed = false;
+
+    _posXScancodes[index] = data.posXScancode;
+    _negXScancodes[index] = data.negXScancode;
+    _posYScancodes[index] = data.posYScancode;
+    _negYScancodes[index] = data.negYScancode;
+    _deadzones[index] = data.deadzone;
+    _keyboardIds[index] = data.keyboardId;
+    return index;
+}
+
+void Vec2CompositeBatch::Compute(const InputPollingState& state)
+{
+    if (!_isIndexed) BuildKeyIndex();
+
+    // Last frame's edges end here, groups with changed keys are recomputed below
+    for (const uint32_t group : _computedGroups) SettleLanes(group * LANES);
+    _computedGroups.clear();
+    ++_computeStamp;
+
+    const uint32_t groupCount = static_cast<uint32_t>(_pastDeadzoneMasks.size());
+    bool isJournaled = _isSeeded;
+    if (!_isSeeded)
+    {
+        Seed(state);
+    }
+    else
+    {
+        isJournaled = state.ForEachChangedKey([this](const SDL_Scancode scancode)
+        {
+            const std::size_t index = static_cast<std::size_t>(scancode);
+            if (index >= KeyBitset::BIT_COUNT) return;
+            for (uint32_t i = _keyCompositeOffsets[index]; i < _keyCompositeOffsets[index + 1]; ++i) MarkGroup(_keyComposites[i] / LANES);
+        });
+    }
+    if (!isJournaled)
+    {
+        for (uint32_t group = 0; group < groupCount; ++group) MarkGroup(group);
+    }
+
+    for (const uint32_t group : _computedGroups)
+    {
+        GatherLanes(state, group * LANES);
+        ComputeLanes(group * LANES);
+    }
+}
+
+InputStatus Vec2CompositeBatch::Evaluate(const uint32_t index, const InputPollingState& state, InputBindingContext& outContext) const
+{
+    const InputStatus status = _statuses[index];
+    const KeyBitset& currentKeys = state.Current().GetKeyboardKeys(state.GetKeyboardSlot(_keyboardIds[index]));
+
+    Vec2Binding::FillContext(GetData(index), state, currentKeys, Vec2{_valueX[index], _valueY[index]},
+                             HasAnyFlag(status, InputStatus::Performed), outContext);
+    return status;
+}
+
+// Protected Fields
+
+// Protected Methods
+
+// Private Fields
+
+// Private Methods
+
+void Vec2CompositeBatch::Seed(const InputPollingState& state)
+{
+    for (std::size_t i = 0; i < _count; ++i)
+    {
+        const Vec2Binding::Data data = GetData(static_cast<uint32_t>(i));
+        const KeyBitset& previousKeys = state.Previous().GetKeyboardKeys(state.GetKeyboardSlot(data.keyboardId));
+
+        uint32_t& mask = _pastDeadzoneMasks[i / LANES];
+        const uint32_t bit = uint32_t{1} << (i % LANES);
+        if (Vec2Binding::CalculateVec2(data, previousKeys).LInfNorm() > data.deadzone) mask |= bit;
+        else mask &= ~bit;
+    }
+    _isSeeded = true;
+}
+
+void Vec2CompositeBatch::BuildKeyIndex()
+{
+    // Same layout as BindingProgram's key-to-action index
+    _keyCompositeOffsets.assign(KeyBitset::BIT_COUNT + 1, 0);
+    for (const auto* scancodes : {&_posXScancodes, &_negXScancodes, &_posYScancodes, &_negYScancodes})
+    {
+        for (std::size_t i = 0; i < _count; ++i)
+        {
+            const std::size_t index = static_cast<std::size_t>((*scancodes)[i]);
+            if (index < KeyBitset::BIT_COUNT) ++_keyCompositeOffsets[index + 1];
+        }
+    }
+    for (std::size_t i = 1; i < _keyCompositeOffsets.size(); ++i) _keyCompositeOffsets[i] += _keyCompositeOffsets[i - 1];
+
+    _keyComposites.resize(_keyCompositeOffsets.back());
+    std::vector<uint32_t> cursor(_keyCompositeOffsets.begin(), _keyCompositeOffsets.end() - 1);
+    for (const auto* scancodes : {&_posXScancodes, &_negXScancodes, &_posYScancodes, &_negYScancodes})
+    {
+        for (std::size_t i = 0; i < _count; ++i)
+        {
+            const std::size_t index = static_cast<std::size_t>((*scancodes)[i]);
+            if (index < KeyBitset::BIT_COUNT) _keyComposites[cursor[index]++] = static_cast<uint32_t>(i);
+        }
+    }
+
+    _isIndexed = true;
+}
+
+void Vec2CompositeBatch::SettleLanes(const std::size_t first)
+{
+    const uint32_t pastDeadzoneMask = _pastDeadzoneMasks[first / LANES];
+    for (std::size_t lane = 0; lane < LANES; ++lane)
+    {
+        _statuses[first + lane] = ((pastDeadzoneMask >> lane) & 1u) ? InputStatus::Performed : InputStatus::Idle;
+    }
+}
+
+void Vec2CompositeBatch::GatherLanes(const InputPollingState& state, const std::size_t first)
+{
+    // Bit tests do not vectorize, so the gather is scalar and everything after it is not
+    const std::size_t end = first + LANES < _count ? first + LANES : _count;
+    for (std::size_t i = first; i < end; ++i)
+    {
+        const KeyBitset& currentKeys = state.Current().GetKeyboardKeys(state.GetKeyboardSlot(_keyboardIds[i]));
+
+        _posX[i] = currentKeys.Test(_posXScancodes[i]) ? 1.0f : 0.0f;
+        _negX[i] = currentKeys.Test(_negXScancodes[i]) ? 1.0f : 0.0f;
+        _posY[i] = currentKeys.Test(_posYScancodes[i]) ? 1.0f : 0.0f;
+        _negY[i] = currentKeys.Test(_negYScancodes[i]) ? 1.0f : 0.0f;
+    }
+}
+
+void Vec2CompositeBatch::ComputeLanes(const std::size_t first)
+{
+    // Bit N of each mask is set if composite (first + N) is past its deadzone
+    uint32_t& pastDeadzoneMask = _pastDeadzoneMasks[first / LANES];
+    const uint32_t wasPastMask = pastDeadzoneMask;
+    uint32_t isPastMask = 0;
+
+#if defined(VELECS_INPUT_SSE2)
+    const __m128 signBit = _mm_set1_ps(-0.0f);
+
+    const __m128 x = _mm_sub_ps(_mm_loadu_ps(&_posX[first]), _mm_loadu_ps(&_negX[first]));
+    const __m128 y = _mm_sub_ps(_mm_loadu_ps(&_posY[first]), _mm_loadu_ps(&_negY[first]));
+    const __m128 norm = _mm_max_ps(_mm_andnot_ps(signBit, x), _mm_andnot_ps(signBit, y));
+
+    isPastMask = static_cast<uint32_t>(_mm_movemask_ps(_mm_cmpgt_ps(norm, _mm_loadu_ps(&_deadzones[first]))));
+
+    _mm_storeu_ps(&_valueX[first], x);
+    _mm_storeu_ps(&_valueY[first], y);
+#elif defined(VELECS_INPUT_NEON)
+    const float32x4_t x = vsubq_f32(vld1q_f32(&_posX[first]), vld1q_f32(&_negX[first]));
+    const float32x4_t y = vsubq_f32(vld1q_f32(&_posY[first]), vld1q_f32(&_negY[first]));
+    const uint32x4_t isPast = vcgtq_f32(vmaxq_f32(vabsq_f32(x), vabsq_f32(y)), vld1q_f32(&_deadzones[first]));
+
+    // NEON has no movemask, so the lane mask is narrowed one lane at a time
+    isPastMask = (vgetq_lane_u32(isPast, 0) & 1u) | (vgetq_lane_u32(isPast, 1) & 2u)
+               | (vgetq_lane_u32(isPast, 2) & 4u) | (vgetq_lane_u32(isPast, 3) & 8u);
+
+    vst1q_f32(&_valueX[first], x);
+    vst1q_f32(&_valueY[first], y);
+#else
+    for (std::size_t lane = 0; lane < LANES; ++lane)
+    {
+        const std::size_t i = first + lane;
+        const Vec2 value{_posX[i] - _negX[i], _posY[i] - _negY[i]};
+        if (value.LInfNorm() > _deadzones[i]) isPastMask |= 1u << lane;
+
+        _valueX[i] = value.x;
+        _valueY[i] = value.y;
+    }
+#endif
+
+    pastDeadzoneMask = isPastMask;
+
+    for (std::size_t lane = 0; lane < LANES; ++lane)
+    {
+        const bool wasPastDeadzone = (wasPastMask >> lane) & 1u;
+        const bool isPastDeadzone = (isPastMask >> lane) & 1u;
+
+        InputStatus status = InputStatus::Idle;
+        if (!wasPastDeadzone  &&  isPastDeadzone) status |= InputStatus::Started;
+        if (                      isPastDeadzone) status |= InputStatus::Performed;
+        if ( wasPastDeadzone  && !isPastDeadzone) status |= InputStatus::Cancelled;
+        _statuses[first + lane] = status;
+    }
+}
+
+} // namespace velecs::input